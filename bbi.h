@@ -30,22 +30,49 @@
 // We did not mean to shout.
 
 #include <algorithm>
+#include <array>
 #include <bit>
 #include <cassert>
 #include <charconv>
 #include <climits>
+#include <concepts>
+#include <cstddef>
 #include <cstdint>
+#include <cstring>
 #include <exception>
 #include <format>
 #include <iostream>
 #include <istream>
 #include <limits>
 #include <ostream>
+#include <span>
 #include <stdexcept>
 #include <string>
 #include <string_view>
 #include <tuple>
 #include <type_traits>
+#include <utility>
+
+// Set to 0 to keep limb arithmetic in portable C++
+#ifndef BBI_CARRY_INTRINSICS
+#  define BBI_CARRY_INTRINSICS 1
+#endif
+
+#if BBI_CARRY_INTRINSICS
+#  if defined(__has_builtin)
+#    if __has_builtin(__builtin_addcll) && __has_builtin(__builtin_subcll)
+#      define BBI_HAS_ADDCLL 1
+#    endif
+#  endif
+#  if !defined(BBI_HAS_ADDCLL) && (defined(__x86_64__) || defined(_M_X64))
+#    define BBI_HAS_ADDCARRY_U64 1
+#    ifdef _MSC_VER
+#      include <intrin.h>
+#    else
+#      include <x86intrin.h>
+#    endif
+#  endif
+#endif  // BBI_CARRY_INTRINSICS
 
 namespace bbi
 {
@@ -59,6 +86,21 @@ namespace bbi
 #  define BBI_FLOAT_CONVERT 0
 #endif
 
+// Products of operands at least this many bits wide use Karatsuba multiplication
+#ifndef BBI_KARATSUBA_THRESHOLD
+#  define BBI_KARATSUBA_THRESHOLD 1024
+#endif
+
+// Products of operands at least this many bits wide use Toom-Cook 3-way multiplication
+#ifndef BBI_TOOM3_THRESHOLD
+#  define BBI_TOOM3_THRESHOLD 16384
+#endif
+
+// gcd of operands at least this many bits wide uses Lehmer's algorithm
+#ifndef BBI_LEHMER_THRESHOLD
+#  define BBI_LEHMER_THRESHOLD 256
+#endif
+
 unsigned constexpr Nlimit = BBI_LIMIT;
 
 struct Signed{ explicit Signed() = default; };
@@ -132,6 +174,11 @@ static_assert(ProperIntSize<Nlimit>);
 template <SignTag S, unsigned N, Policy P, bool small = N <= Nlimit>
 class Z;
 
+template <class T> struct div_t;
+template <class T> class divider;
+template <class T> class montgomery;
+template <class T> class barrett;
+
 template <class X>
 requires (SignTag<typename X::sign> && std::is_unsigned_v<decltype(X::size)>
           && Policy<typename X::policy>)
@@ -186,10 +233,14 @@ Z<Signed, 2*N, Wrap>
 mul2(Z<Signed, N, Wrap> const& x, Z<Signed, N, Wrap> const& y) noexcept;
 
 template <unsigned N>
-requires(N <= Nlimit)
 constexpr
-unsigned
-divu10(Z<Unsigned, N, Wrap>& u) noexcept;
+Z<Unsigned, 2*N, Wrap>
+sqr2(Z<Unsigned, N, Wrap> const& x) noexcept;
+
+template <unsigned N>
+constexpr
+Z<Signed, 2*N, Wrap>
+sqr2(Z<Signed, N, Wrap> const& x) noexcept;
 
 template <class I>
 concept StandardSignedInteger = std::is_same_v<I, signed char> ||
@@ -255,482 +306,889 @@ struct isz<Z<S, N, P, B>> : std::true_type {};
 template <class T>
 concept isZ = isz<T>::value;
 
-}  // namespace detail
+// Integers wider than Nlimit are stored as a flat, little-endian array of limbs.
+// A limb is the widest native unsigned type that is no wider than Nlimit or 64 bits.
+using limb_t = std::tuple_element_t<std::countr_zero(std::min(Nlimit, 64u)) - 3,
+                                    std::tuple<std::uint8_t, std::uint16_t,
+                                               std::uint32_t, std::uint64_t>>;
+unsigned constexpr limb_bits = sizeof(limb_t)*CHAR_BIT;
+limb_t constexpr limb_max = std::numeric_limits<limb_t>::max();
 
-template <SignTag S, unsigned N, Policy P>
-std::string
-to_string(Z<S, N, P> const& x);
+// Limb kernels for the wide representation.
+// All operate on little-endian limb arrays.
 
-template <SignTag S, unsigned N, Policy P>
-class Z<S, N, P, true>
+// Returns the low limb of x*y and stores the high limb in hi
+template <class L>
+constexpr
+inline
+L
+mul_limb(L x, L y, L& hi) noexcept
 {
-public:
-    using sign = S;
-    static constexpr auto size = N;
-    using policy = P;
-
-private:
-    using utypes = std::tuple<std::uint8_t, std::uint16_t, std::uint32_t, std::uint64_t
-#ifndef _MSC_VER
-                                                                        , __uint128_t
+#ifdef _MSC_VER
+    if constexpr (limb_bits == 64)
+    {
+        L constexpr mask = limb_max >> limb_bits/2;
+        auto const x0 = x & mask;
+        auto const x1 = x >> limb_bits/2;
+        auto const y0 = y & mask;
+        auto const y1 = y >> limb_bits/2;
+        auto const p00 = x0*y0;
+        auto const p01 = x0*y1;
+        auto const p10 = x1*y0;
+        auto const p11 = x1*y1;
+        auto const m = (p00 >> limb_bits/2) + (p01 & mask) + (p10 & mask);
+        hi = p11 + (p01 >> limb_bits/2) + (p10 >> limb_bits/2) + (m >> limb_bits/2);
+        return (m << limb_bits/2) | (p00 & mask);
+    }
+    else
 #endif
-                                                                                       >;
-    using stypes = std::tuple< std::int8_t,  std::int16_t,  std::int32_t,  std::int64_t
+    {
+        using dlimb_t = std::tuple_element_t<std::countr_zero(2*limb_bits) - 4,
+                                             std::tuple<std::uint16_t, std::uint32_t,
+                                                        std::uint64_t
 #ifndef _MSC_VER
-                                                                        , __int128_t
+                                                                     , __uint128_t
 #endif
-                                                                                       >;
-    using urep_t = std::tuple_element_t<std::countr_zero(size)-3, utypes>;
-    using srep_t = std::tuple_element_t<std::countr_zero(size)-3, stypes>;
-
-    urep_t rep_;
+                                                                                  >>;
+        auto const p = dlimb_t(dlimb_t(x)*dlimb_t(y));
+        hi = L(p >> limb_bits);
+        return L(p);
+    }
+}
 
-public:
-    using rep = std::conditional_t<sign{} == Signed{}, srep_t, urep_t>;
+// Returns x + y + c and stores the carry out in c.  c must be 0 or 1.
+constexpr
+inline
+limb_t
+addc(limb_t x, limb_t y, limb_t& c) noexcept
+{
+    if constexpr (limb_bits == 64)
+    {
+        if (!std::is_constant_evaluated())
+        {
+#if defined(BBI_HAS_ADDCLL)
+            unsigned long long co;
+            auto const r = __builtin_addcll(x, y, c, &co);
+            c = co;
+            return r;
+#elif defined(BBI_HAS_ADDCARRY_U64)
+            unsigned long long r;
+            c = _addcarry_u64(static_cast<unsigned char>(c), x, y, &r);
+            return r;
+#endif
+        }
+    }
+    auto t = limb_t(x + c);
+    c = t < c;
+    t = limb_t(t + y);
+    c += t < y;
+    return t;
+}
 
-    Z() = default;
+// Returns x - y - b and stores the borrow out in b.  b must be 0 or 1.
+constexpr
+inline
+limb_t
+subb(limb_t x, limb_t y, limb_t& b) noexcept
+{
+    if constexpr (limb_bits == 64)
+    {
+        if (!std::is_constant_evaluated())
+        {
+#if defined(BBI_HAS_ADDCLL)
+            unsigned long long bo;
+            auto const r = __builtin_subcll(x, y, b, &bo);
+            b = bo;
+            return r;
+#elif defined(BBI_HAS_ADDCARRY_U64)
+            unsigned long long r;
+            b = _subborrow_u64(static_cast<unsigned char>(b), x, y, &r);
+            return r;
+#endif
+        }
+    }
+    auto const t = limb_t(x - y);
+    auto const b1 = limb_t(x < y);
+    auto const r = limb_t(t - b);
+    b = b1 | limb_t(t < b);
+    return r;
+}
 
-    // Construct from integral type.
-    // Implicit if lossless, otherwise explicit
-    template <std::integral I>
-        constexpr
-        explicit(detail::ExplicitFromI<Z, I>)
-        Z(I i)
-            noexcept(detail::NoexceptFromI<Z, I>)
-            : rep_(i)
-            {detail::check(*this, i);}
+// r[0, n) = x[0, n) + y[0, n) + c.  Returns the carry.
+constexpr
+inline
+limb_t
+add_n(limb_t* r, limb_t const* x, limb_t const* y, unsigned n, limb_t c = 0) noexcept
+{
+    unsigned j = 0;
+    for (; j + 4 <= n; j += 4)
+    {
+        r[j]   = addc(x[j],   y[j],   c);
+        r[j+1] = addc(x[j+1], y[j+1], c);
+        r[j+2] = addc(x[j+2], y[j+2], c);
+        r[j+3] = addc(x[j+3], y[j+3], c);
+    }
+    for (; j < n; ++j)
+        r[j] = addc(x[j], y[j], c);
+    return c;
+}
 
-#if BBI_FLOAT_CONVERT
-    template <std::floating_point F>
-        constexpr
-        explicit
-        Z(F f)
-            noexcept(detail::NoexceptFromF<Z, F>)
-            : rep_(f)
-            {detail::check(*this, f);}
-#endif  // BBI_FLOAT_CONVERT
+// r[0, n) = x[0, n) - y[0, n) - b.  Returns the borrow.
+constexpr
+inline
+limb_t
+sub_n(limb_t* r, limb_t const* x, limb_t const* y, unsigned n, limb_t b = 0) noexcept
+{
+    unsigned j = 0;
+    for (; j + 4 <= n; j += 4)
+    {
+        r[j]   = subb(x[j],   y[j],   b);
+        r[j+1] = subb(x[j+1], y[j+1], b);
+        r[j+2] = subb(x[j+2], y[j+2], b);
+        r[j+3] = subb(x[j+3], y[j+3], b);
+    }
+    for (; j < n; ++j)
+        r[j] = subb(x[j], y[j], b);
+    return b;
+}
 
-    // Construction from other Z
+// r[0, n) = x[0, n) + c.  Returns the carry.
+constexpr
+inline
+limb_t
+add_1(limb_t* r, limb_t const* x, unsigned n, limb_t c) noexcept
+{
+    for (unsigned j = 0; j < n; ++j)
+    {
+        auto const t = limb_t(x[j] + c);
+        c = t < c;
+        r[j] = t;
+    }
+    return c;
+}
 
-    template <unsigned N2, Policy P2>
-        requires (N2 < size)
-        explicit(detail::ExplicitFromZ<Z, Z<Unsigned, N2, P2>>)
-        constexpr
-        Z(Z<Unsigned, N2, P2> const& x)
-            noexcept(detail::NoexceptFromZ<Z, Z<Unsigned, N2, P2>>)
-            : rep_{x.rep_} {detail::check(*this, x);}
+// r[0, n) = x[0, n) - b.  Returns the borrow.
+constexpr
+inline
+limb_t
+sub_1(limb_t* r, limb_t const* x, unsigned n, limb_t b) noexcept
+{
+    for (unsigned j = 0; j < n; ++j)
+    {
+        auto const xj = x[j];
+        r[j] = limb_t(xj - b);
+        b = xj < b;
+    }
+    return b;
+}
 
-    template <unsigned N2, Policy P2>
-        requires (N2 < size)
-        explicit(detail::ExplicitFromZ<Z, Z<Signed, N2, P2>>)
-        constexpr
-        Z(Z<Signed, N2, P2> const& x)
-            noexcept(detail::NoexceptFromZ<Z, Z<Signed, N2, P2>>)
-            : rep_(srep_t{typename Z<Signed, N2, P2>::srep_t(x.rep_)})
-              {detail::check(*this, x);}
+// r[0, n) = x[0, n) << s with 0 < s < limb_bits.  Returns the bits shifted out.
+constexpr
+inline
+limb_t
+lshift_n(limb_t* r, limb_t const* x, unsigned n, unsigned s) noexcept
+{
+    auto const out = limb_t(x[n-1] >> (limb_bits - s));
+    for (unsigned j = n-1; j > 0; --j)
+        r[j] = limb_t(x[j] << s) | limb_t(x[j-1] >> (limb_bits - s));
+    r[0] = limb_t(x[0] << s);
+    return out;
+}
 
-    template <SignTag S2, Policy P2>
-        requires (sign{} != S2{} || policy{} != P2{})
-        explicit(detail::ExplicitFromZ<Z, Z<S2, size, P2>>)
-        constexpr
-        Z(Z<S2, size, P2> const& x)
-            noexcept(detail::NoexceptFromZ<Z, Z<S2, size, P2>>)
-            : rep_{x.rep_} {detail::check(*this, x);}
+// r[0, n) = x[0, n) >> s with 0 < s < limb_bits.
+// Returns the bits shifted out, in the high order bits of a limb.
+constexpr
+inline
+limb_t
+rshift_n(limb_t* r, limb_t const* x, unsigned n, unsigned s) noexcept
+{
+    auto const out = limb_t(x[0] << (limb_bits - s));
+    for (unsigned j = 0; j < n-1; ++j)
+        r[j] = limb_t(x[j] >> s) | limb_t(x[j+1] << (limb_bits - s));
+    r[n-1] = limb_t(x[n-1] >> s);
+    return out;
+}
 
-    template <SignTag S2, unsigned N2, Policy P2>
-        requires (N2 > size && N2 <= Nlimit)
-        constexpr
-        explicit(detail::ExplicitFromZ<Z, Z<S2, N2, P2>>)
-        Z(Z<S2, N2, P2> const& x)
-            noexcept(detail::NoexceptFromZ<Z, Z<S2, N2, P2>>)
-            : rep_(x.rep_) {detail::check(*this, x);}
+// r[0, n) = x[0, n) / 3.  x must be a multiple of 3.
+constexpr
+inline
+void
+divexact_by3(limb_t* r, limb_t const* x, unsigned n) noexcept
+{
+    // limb_bits is even, so 3 divides limb_max
+    limb_t constexpr third = limb_max / 3;
+    limb_t constexpr inv3 = 2*third + 1;  // 3*inv3 == 1 modulo 2^limb_bits
+    limb_t c{};
+    for (unsigned j = 0; j < n; ++j)
+    {
+        auto const xj = x[j];
+        auto const q = limb_t(std::uint64_t{limb_t(xj - c)}*inv3);
+        r[j] = q;
+        // c is the borrow plus the high limb of 3*q
+        c = limb_t((xj < c) + (q > third) + (q > 2*third));
+    }
+}
 
-    template <SignTag S2, unsigned N2, Policy P2>
-        requires (N2 == size*2 && Nlimit < N2)
-        constexpr
-        explicit(detail::ExplicitFromZ<Z, Z<S2, N2, P2>>)
-        Z(Z<S2, N2, P2> const& x)
-            noexcept(detail::NoexceptFromZ<Z, Z<S2, N2, P2>>)
-            : rep_(x.lo_) {detail::check(*this, x);}
+// Returns -1, 0 or 1 as x[0, n) is less than, equal to or greater than y[0, n)
+constexpr
+inline
+int
+cmp_n(limb_t const* x, limb_t const* y, unsigned n) noexcept
+{
+    for (unsigned j = n; j-- > 0;)
+    {
+        if (x[j] != y[j])
+            return x[j] < y[j] ? -1 : 1;
+    }
+    return 0;
+}
 
-    template <SignTag S2, unsigned N2, Policy P2>
-        requires (N2 > size*2 && Nlimit < N2)
-        constexpr
-        explicit(detail::ExplicitFromZ<Z, Z<S2, N2, P2>>)
-        Z(Z<S2, N2, P2> const& x)
-            noexcept(detail::NoexceptFromZ<Z, Z<S2, N2, P2>>)
-            : Z{Z<S2, size*2, policy>{x}} {}
+// r[0, n) += x[0, n) * y.  Returns the carry limb.
+constexpr
+inline
+limb_t
+addmul_1(limb_t* r, limb_t const* x, unsigned n, limb_t y) noexcept
+{
+    limb_t c{};
+    for (unsigned j = 0; j < n; ++j)
+    {
+        limb_t hi;
+        auto lo = mul_limb(x[j], y, hi);
+        lo = limb_t(lo + c);
+        hi += lo < c;
+        auto const rj = r[j];
+        lo = limb_t(lo + rj);
+        hi += lo < rj;
+        r[j] = lo;
+        c = hi;
+    }
+    return c;
+}
 
-    explicit constexpr Z(std::string_view s);
-    explicit constexpr Z(std::string_view s, unsigned& i);
-    explicit operator std::string() const;
+// r[0, n) = x[0, n) * y + c.  Returns the carry limb.
+constexpr
+inline
+limb_t
+mul_1(limb_t* r, limb_t const* x, unsigned n, limb_t y, limb_t c) noexcept
+{
+    for (unsigned j = 0; j < n; ++j)
+    {
+        limb_t hi;
+        auto lo = mul_limb(x[j], y, hi);
+        lo = limb_t(lo + c);
+        hi += lo < c;
+        r[j] = lo;
+        c = hi;
+    }
+    return c;
+}
 
-    constexpr explicit operator bool() const noexcept {return bool(rep_);}
+// r[0, xn+yn) = x[0, xn) * y[0, yn).  r must not overlap x or y.
+constexpr
+inline
+void
+mul_basecase(limb_t* r, limb_t const* x, unsigned xn, limb_t const* y, unsigned yn) noexcept
+{
+    for (unsigned j = 0; j < yn; ++j)
+        r[j] = 0;
+    for (unsigned i = 0; i < xn; ++i)
+        r[i+yn] = addmul_1(r+i, y, yn, x[i]);
+}
 
-    template <std::integral I>
-        constexpr explicit operator I() const noexcept {return I(rep(rep_));}
-#if BBI_FLOAT_CONVERT
-    template <std::floating_point F>
-        constexpr
-        operator F() const noexcept {return F(rep(rep_));}
-#endif  // BBI_FLOAT_CONVERT
+// r[0, 2n) = x[0, n)^2.  r must not overlap x.
+constexpr
+inline
+void
+sqr_basecase(limb_t* r, limb_t const* x, unsigned n) noexcept
+{
+    // Sum the products x[i]*x[j] with i < j once, double it, then add the squares
+    for (unsigned j = 0; j < n; ++j)
+        r[j] = 0;
+    for (unsigned i = 0; i < n; ++i)
+        r[n+i] = addmul_1(r+2*i+1, x+i+1, n-i-1, x[i]);
+    lshift_n(r, r, 2*n, 1);
+    limb_t c{};
+    for (unsigned i = 0; i < n; ++i)
+    {
+        limb_t hi;
+        auto const lo = mul_limb(x[i], x[i], hi);
+        r[2*i] = addc(r[2*i], lo, c);
+        r[2*i+1] = addc(r[2*i+1], hi, c);
+    }
+}
 
-    constexpr Z operator+() noexcept {return *this;}
-    constexpr Z& operator++() noexcept(policy{} != Throw{})
-        {*this += Z{1}; return *this;}
-    constexpr Z operator++(int) noexcept(policy{} != Throw{})
-        {auto t(*this); ++(*this); return t;}
+// Stores |x[0, xn) - y[0, yn)| in r[0, xn) and returns true if x < y.
+// Requires yn <= xn.
+constexpr
+inline
+bool
+abs_sub(limb_t* r, limb_t const* x, unsigned xn, limb_t const* y, unsigned yn) noexcept
+{
+    bool x_lt_y = false;
+    unsigned j = xn;
+    while (j > yn && x[j-1] == 0)
+        --j;
+    if (j == yn)
+        x_lt_y = cmp_n(x, y, yn) < 0;
+    if (x_lt_y)
+    {
+        sub_n(r, y, x, yn);
+        for (j = yn; j < xn; ++j)
+            r[j] = 0;
+    }
+    else
+    {
+        auto const b = sub_n(r, x, y, yn);
+        sub_1(r+yn, x+yn, xn-yn, b);
+    }
+    return x_lt_y;
+}
 
-    constexpr Z& operator--() noexcept(policy{} != Throw{})
-        {*this -= Z{1}; return *this;}
-    constexpr Z operator--(int) noexcept(policy{} != Throw{})
-        {auto t(*this); --(*this); return t;}
+template <unsigned n>
+constexpr
+void
+mul_n(limb_t* r, limb_t const* x, limb_t const* y) noexcept;
 
-    constexpr Z& operator+=(Z const& x) noexcept(policy{} != Throw{})
-        {*this = *this + x; return *this;}
-    constexpr Z& operator-=(Z const& x) noexcept(policy{} != Throw{})
-        {*this = *this - x; return *this;}
-    constexpr Z& operator*=(Z const& x) noexcept(policy{} != Throw{})
-        {*this = *this * x; return *this;}
-    constexpr Z& operator/=(Z const& x) noexcept(policy{} != Throw{})
-        {*this = *this / x; return *this;}
-    constexpr Z& operator%=(Z const& x) noexcept(policy{} != Throw{})
-        {*this = *this % x; return *this;}
-    constexpr Z& operator<<=(int n) noexcept(policy{} != Throw{})
-        {*this = *this << n; return *this;}
-    constexpr Z& operator<<=(Z const& n) noexcept(policy{} != Throw{})
-        {*this = *this << n; return *this;}
-    constexpr Z& operator>>=(int n) noexcept(policy{} != Throw{})
-        {*this = *this >> n; return *this;}
-    constexpr Z& operator>>=(Z const& n) noexcept(policy{} != Throw{})
-        {*this = *this >> n; return *this;}
-    constexpr Z& operator&=(Z const& y) noexcept(policy{} != Throw{})
-        {*this = *this & y; return *this;}
-    constexpr Z& operator^=(Z const& y) noexcept(policy{} != Throw{})
-        {*this = *this ^ y; return *this;}
-    constexpr Z& operator|=(Z const& y) noexcept(policy{} != Throw{})
-        {*this = *this | y; return *this;}
+// r[0, 2n) = x[0, n) * y[0, n).  r must not overlap x or y.
+template <unsigned n>
+constexpr
+inline
+void
+mul_karatsuba(limb_t* r, limb_t const* x, limb_t const* y) noexcept
+{
+    // With x = x1*B^h + x0 and y = y1*B^h + y0
+    // x*y = x1*y1*B^2h + (x0*y0 + x1*y1 - (x0 - x1)*(y0 - y1))*B^h + x0*y0
+    unsigned constexpr h = n - n/2;  // x0 and y0 have h limbs
+    unsigned constexpr l = n/2;      // x1 and y1 have l limbs
+    // When squaring, x and y are the same and so are dx and dy
+    bool const sqr = x == y;
+    std::array<limb_t, h> dx;
+    std::array<limb_t, h> dy;
+    bool neg = abs_sub(dx.data(), x, h, x+h, l);
+    auto const pdy = sqr ? dx.data() : dy.data();
+    if (sqr)
+        neg = false;
+    else
+        neg = neg != abs_sub(dy.data(), y, h, y+h, l);
+    mul_n<h>(r, x, y);
+    mul_n<l>(r+2*h, x+h, y+h);
+    std::array<limb_t, 2*h> t;
+    mul_n<h>(t.data(), dx.data(), pdy);
+    // m = x0*y0 + x1*y1 - (x0 - x1)*(y0 - y1) is 2h limbs plus the carry c
+    std::array<limb_t, 2*h> m;
+    auto c = add_n(m.data(), r, r+2*h, 2*l);
+    c = add_1(m.data()+2*l, r+2*l, 2*(h-l), c);
+    if (neg)
+        c = limb_t(c + add_n(m.data(), m.data(), t.data(), 2*h));
+    else
+        c = limb_t(c - sub_n(m.data(), m.data(), t.data(), 2*h));
+    c = limb_t(c + add_n(r+h, r+h, m.data(), 2*h));
+    add_1(r+3*h, r+3*h, 2*n-3*h, c);
+}
 
-private:
-    template <SignTag S2, unsigned N2, Policy P2, bool>
-    friend
-    class Z;
+// r[0, 2n) = x[0, n) * y[0, n).  r must not overlap x or y.
+template <unsigned n>
+constexpr
+inline
+void
+mul_toom3(limb_t* r, limb_t const* x, limb_t const* y) noexcept
+{
+    // Split x = x2*B^2k + x1*B^k + x0, and y likewise, and view the product
+    // as the polynomial x(t)*y(t) = r4*t^4 + r3*t^3 + r2*t^2 + r1*t + r0 at t = B^k.
+    // Evaluate at t = 0, 1, -1, 2 and infinity and interpolate.
+    // Every coefficient is non-negative, so the interpolation stays unsigned.
+    unsigned constexpr k = (n + 2) / 3;  // x0, x1, y0 and y1 have k limbs
+    unsigned constexpr q = n - 2*k;      // x2 and y2 have q limbs
+    unsigned constexpr w = 2*k + 2;      // room for each product and coefficient
+    using E = std::array<limb_t, k+1>;   // an evaluated factor
+    using W = std::array<limb_t, w>;     // a product or coefficient
+
+    // Evaluate a factor at 1, -1 and 2.  The value at -1 is returned as a
+    // magnitude and a sign.
+    auto evaluate = [](limb_t const* a, E& a1, E& am1, E& a2) -> bool
+    {
+        E p;  // a0 + a2
+        p[k] = add_1(p.data()+q, a+q, k-q, add_n(p.data(), a, a+2*k, q));
+        a1[k] = limb_t(p[k] + add_n(a1.data(), p.data(), a+k, k));
+        bool const neg = abs_sub(am1.data(), p.data(), k+1, a+k, k);
+        // a0 + 2*(a1 + 2*a2)
+        a2[k] = 0;
+        for (unsigned j = 0; j < q; ++j)
+            a2[j] = a[2*k+j];
+        for (unsigned j = q; j < k; ++j)
+            a2[j] = 0;
+        lshift_n(a2.data(), a2.data(), k+1, 1);
+        a2[k] = limb_t(a2[k] + add_n(a2.data(), a2.data(), a+k, k));
+        lshift_n(a2.data(), a2.data(), k+1, 1);
+        a2[k] = limb_t(a2[k] + add_n(a2.data(), a2.data(), a, k));
+        return neg;
+    };
+    // When squaring, x and y are the same and y is not evaluated
+    bool const sqr = x == y;
+    E x1;
+    E xm1;
+    E x2;
+    E y1;
+    E ym1;
+    E y2;
+    bool neg = evaluate(x, x1, xm1, x2);
+    if (sqr)
+        neg = false;
+    else
+        neg = neg != evaluate(y, y1, ym1, y2);
+    auto const py1 = sqr ? x1.data() : y1.data();
+    auto const pym1 = sqr ? xm1.data() : ym1.data();
+    auto const py2 = sqr ? x2.data() : y2.data();
+
+    // r0 = x0*y0 and r4 = x2*y2 go straight to their place in r
+    mul_n<k>(r, x, y);
+    for (unsigned j = 2*k; j < 4*k; ++j)
+        r[j] = 0;
+    mul_n<q>(r+4*k, x+2*k, y+2*k);
+    W v1;
+    W vm1;
+    W v2;
+    mul_n<k+1>(v1.data(), x1.data(), py1);
+    mul_n<k+1>(vm1.data(), xm1.data(), pym1);
+    mul_n<k+1>(v2.data(), x2.data(), py2);
+
+    W r0{};
+    W r4{};
+    for (unsigned j = 0; j < 2*k; ++j)
+        r0[j] = r[j];
+    for (unsigned j = 0; j < 2*q; ++j)
+        r4[j] = r[4*k+j];
+
+    // r1 + r3 = (v1 - vm1)/2 and r0 + r2 + r4 = (v1 + vm1)/2
+    W d;
+    W r2;
+    if (neg)
+    {
+        add_n(d.data(), v1.data(), vm1.data(), w);
+        sub_n(r2.data(), v1.data(), vm1.data(), w);
+    }
+    else
+    {
+        sub_n(d.data(), v1.data(), vm1.data(), w);
+        add_n(r2.data(), v1.data(), vm1.data(), w);
+    }
+    rshift_n(d.data(), d.data(), w, 1);
+    rshift_n(r2.data(), r2.data(), w, 1);
+    sub_n(r2.data(), r2.data(), r0.data(), w);
+    sub_n(r2.data(), r2.data(), r4.data(), w);
+
+    // 6*r3 = v2 - r0 - 4*r2 - 16*r4 - 2*(r1 + r3)
+    W r3;
+    W t;
+    sub_n(r3.data(), v2.data(), r0.data(), w);
+    lshift_n(t.data(), r2.data(), w, 2);
+    sub_n(r3.data(), r3.data(), t.data(), w);
+    lshift_n(t.data(), r4.data(), w, 4);
+    sub_n(r3.data(), r3.data(), t.data(), w);
+    lshift_n(t.data(), d.data(), w, 1);
+    sub_n(r3.data(), r3.data(), t.data(), w);
+    rshift_n(r3.data(), r3.data(), w, 1);
+    divexact_by3(r3.data(), r3.data(), w);
+
+    // r1 = (r1 + r3) - r3
+    W& r1 = d;
+    sub_n(r1.data(), d.data(), r3.data(), w);
+
+    // r += r1*B^k + r2*B^2k + r3*B^3k
+    auto add_at = [r](unsigned i, W const& v)
+    {
+        auto const m = 2*n - i < w ? 2*n - i : w;
+        auto const c = add_n(r+i, r+i, v.data(), m);
+        add_1(r+i+m, r+i+m, 2*n - i - m, c);
+    };
+    add_at(k, r1);
+    add_at(2*k, r2);
+    add_at(3*k, r3);
+}
 
-    template <SignTag S1, unsigned N1, Policy P1>
-    friend
-    constexpr
-    Z<S1, N1, P1>
-    detail::zero_high_bit(Z<S1, N1, P1> x) noexcept;
+// r[0, 2n) = x[0, n) * y[0, n).  r must not overlap x or y.
+// If x and y are the same pointer, the product is computed as a square.
+template <unsigned n>
+constexpr
+inline
+void
+mul_n(limb_t* r, limb_t const* x, limb_t const* y) noexcept
+{
+    if constexpr (n*limb_bits < BBI_KARATSUBA_THRESHOLD || n < 2)
+    {
+        if (x == y)
+            sqr_basecase(r, x, n);
+        else
+            mul_basecase(r, x, n, y, n);
+    }
+    else if constexpr (n*limb_bits < BBI_TOOM3_THRESHOLD || n < 3)
+        mul_karatsuba<n>(r, x, y);
+    else
+        mul_toom3<n>(r, x, y);
+}
 
-    template <SignTag S1, unsigned N1, Policy P1>
-    friend
-    constexpr
-    Z<S1, N1, P1>
-    detail::set_high_bit(Z<S1, N1, P1> x) noexcept;
+// r[0, 2n) = x[0, n)^2.  r must not overlap x.
+template <unsigned n>
+constexpr
+inline
+void
+sqr_n(limb_t* r, limb_t const* x) noexcept
+{
+    mul_n<n>(r, x, x);
+}
 
-    template <SignTag S1, unsigned N1, Policy P1, std::integral I>
-    friend
-    constexpr
-    void
-    detail::check(Z<S1, N1, P1>& r, I i) noexcept (P1{} != Throw{});
+// r[0, n) = x[0, n) * y[0, n) modulo B^n.  r must not overlap x or y.
+// If x and y are the same pointer, the product is computed as a square.
+template <unsigned n>
+constexpr
+inline
+void
+mullo_n(limb_t* r, limb_t const* x, limb_t const* y) noexcept
+{
+    if constexpr (n*limb_bits < BBI_KARATSUBA_THRESHOLD || n < 2)
+    {
+        for (unsigned j = 0; j < n; ++j)
+            r[j] = 0;
+        if (x == y)
+        {
+            // As sqr_basecase, keeping only the low n limbs
+            for (unsigned i = 0; 2*i+1 < n; ++i)
+                addmul_1(r+2*i+1, x+i+1, n-2*i-1, x[i]);
+            lshift_n(r, r, n, 1);
+            limb_t c{};
+            for (unsigned i = 0; 2*i < n; ++i)
+            {
+                limb_t hi;
+                auto const lo = mul_limb(x[i], x[i], hi);
+                r[2*i] = addc(r[2*i], lo, c);
+                if (2*i+1 < n)
+                    r[2*i+1] = addc(r[2*i+1], hi, c);
+            }
+        }
+        else
+        {
+            for (unsigned i = 0; i < n; ++i)
+                addmul_1(r+i, y, n-i, x[i]);
+        }
+    }
+    else
+    {
+        // With x = x1*B^h + x0 and y = y1*B^h + y0
+        // x*y == x0*y0 + (x1*y0 + x0*y1)*B^h modulo B^n
+        unsigned constexpr h = n - n/2;  // x0 and y0 have h limbs
+        unsigned constexpr l = n/2;      // x1 and y1 have l limbs
+        std::array<limb_t, 2*h> p;
+        mul_n<h>(p.data(), x, y);
+        for (unsigned j = 0; j < n; ++j)
+            r[j] = p[j];
+        std::array<limb_t, l> t;
+        if (x == y)
+        {
+            mullo_n<l>(t.data(), x+h, x);
+            lshift_n(t.data(), t.data(), l, 1);
+            add_n(r+h, r+h, t.data(), l);
+        }
+        else
+        {
+            mullo_n<l>(t.data(), x+h, y);
+            add_n(r+h, r+h, t.data(), l);
+            mullo_n<l>(t.data(), x, y+h);
+            add_n(r+h, r+h, t.data(), l);
+        }
+    }
+}
 
-#if BBI_FLOAT_CONVERT
-    template <SignTag S1, unsigned N1, Policy P1, std::floating_point F>
-    friend
-    constexpr
-    void
-    detail::check(Z<S1, N1, P1>& r, F i) noexcept (P1{} != Throw{});
-#endif  // BBI_FLOAT_CONVERT
+// r[0, n) -= x[0, n) * y.  Returns the borrow limb.
+constexpr
+inline
+limb_t
+submul_1(limb_t* r, limb_t const* x, unsigned n, limb_t y) noexcept
+{
+    limb_t c{};
+    for (unsigned j = 0; j < n; ++j)
+    {
+        limb_t hi;
+        auto lo = mul_limb(x[j], y, hi);
+        lo = limb_t(lo + c);
+        hi += lo < c;
+        auto const rj = r[j];
+        r[j] = limb_t(rj - lo);
+        hi += rj < lo;
+        c = hi;
+    }
+    return c;
+}
 
-    template <SignTag S1, unsigned N1, Policy P1, SignTag S2, unsigned N2, Policy P2>
-    friend
-    constexpr
-    void
-    detail::check(Z<S1, N1, P1>& r, Z<S2, N2, P2> const& x)
-        noexcept (P1{} != Throw{});
+// Returns (u1*2^limb_bits + u0) / d and stores the remainder in r.
+// Requires u1 < d and the high bit of d set.
+template <class L>
+constexpr
+inline
+L
+div_limb(L u1, L u0, L d, L& r) noexcept
+{
+#ifdef _MSC_VER
+    if constexpr (limb_bits == 64)
+    {
+        // Divide 4 half limbs by 2 half limbs, Knuth's Algorithm D with base 2^32
+        L constexpr b = L{1} << limb_bits/2;
+        L constexpr mask = limb_max >> limb_bits/2;
+        auto const d1 = d >> limb_bits/2;
+        auto const d0 = d & mask;
+        auto const u01 = u0 >> limb_bits/2;
+        auto const u00 = u0 & mask;
+        auto q1 = u1 / d1;
+        auto rhat = u1 - q1*d1;
+        while (q1 >= b || q1*d0 > (rhat << limb_bits/2) + u01)
+        {
+            --q1;
+            rhat += d1;
+            if (rhat >= b)
+                break;
+        }
+        auto const u21 = (u1 << limb_bits/2) + u01 - q1*d;
+        auto q0 = u21 / d1;
+        rhat = u21 - q0*d1;
+        while (q0 >= b || q0*d0 > (rhat << limb_bits/2) + u00)
+        {
+            --q0;
+            rhat += d1;
+            if (rhat >= b)
+                break;
+        }
+        r = (u21 << limb_bits/2) + u00 - q0*d;
+        return (q1 << limb_bits/2) | q0;
+    }
+    else
+#endif
+    {
+        using dlimb_t = std::tuple_element_t<std::countr_zero(2*limb_bits) - 4,
+                                             std::tuple<std::uint16_t, std::uint32_t,
+                                                        std::uint64_t
+#ifndef _MSC_VER
+                                                                     , __uint128_t
+#endif
+                                                                                  >>;
+        auto const u = dlimb_t(dlimb_t(u1) << limb_bits) | u0;
+        auto const q = L(u / d);
+        r = L(u % d);
+        return q;
+    }
+}
 
-    template <SignTag S2, unsigned N2, Policy P2>
-    friend
-    constexpr
-    bool
-    operator==(Z<S2, N2, P2> const& x, Z<S2, N2, P2> const& y) noexcept;
+// Returns floor((2^(2*limb_bits) - 1) / d) - 2^limb_bits, the reciprocal of d
+// used by div_limb_preinv.  Requires the high bit of d set.
+constexpr
+inline
+limb_t
+reciprocal(limb_t d) noexcept
+{
+    limb_t r;
+    return div_limb(limb_t(~d), limb_max, d, r);
+}
 
-    template <SignTag S2, unsigned N2, Policy P2>
-    friend
-    constexpr
-    bool
-    operator<(Z<S2, N2, P2> const& x, Z<S2, N2, P2> const& y) noexcept;
+// As div_limb, but with v == reciprocal(d) it only multiplies.
+// Möller and Granlund, "Improved division by invariant integers", Algorithm 4.
+constexpr
+inline
+limb_t
+div_limb_preinv(limb_t u1, limb_t u0, limb_t d, limb_t v, limb_t& r) noexcept
+{
+    limb_t q1;
+    auto q0 = mul_limb(v, u1, q1);
+    limb_t c{};
+    q0 = addc(q0, u0, c);
+    q1 = limb_t(q1 + u1 + 1 + c);
+    limb_t hi;
+    r = limb_t(u0 - mul_limb(q1, d, hi));
+    if (r > q0)
+    {
+        --q1;
+        r = limb_t(r + d);
+    }
+    if (r >= d)
+    {
+        ++q1;
+        r = limb_t(r - d);
+    }
+    return q1;
+}
 
-    template <SignTag S2, unsigned N2>
-    friend
-    constexpr
-    Z<S2, N2, Wrap>
-    operator<<(Z<S2, N2, Wrap> const& x, int n) noexcept;
+// q[0, n) = x[0, n) / d and returns x[0, n) % d.  d << s must have its high bit
+// set and v == reciprocal(d << s).  x is shifted by s on the fly.  q may be x.
+constexpr
+inline
+limb_t
+divrem_1(limb_t* q, limb_t const* x, unsigned n, limb_t d, unsigned s, limb_t v) noexcept
+{
+    auto const dn = limb_t(d << s);
+    limb_t r{};
+    if (s == 0)
+    {
+        for (unsigned j = n; j-- > 0;)
+            q[j] = div_limb_preinv(r, x[j], dn, v, r);
+        return r;
+    }
+    r = limb_t(x[n-1] >> (limb_bits - s));
+    for (unsigned j = n; j-- > 1;)
+        q[j] = div_limb_preinv(r, limb_t(x[j] << s) | limb_t(x[j-1] >> (limb_bits - s)),
+                               dn, v, r);
+    q[0] = div_limb_preinv(r, limb_t(x[0] << s), dn, v, r);
+    return limb_t(r >> s);
+}
 
-    template <SignTag S2, unsigned N2>
-    friend
-    constexpr
-    Z<S2, N2, Saturate>
-    operator<<(Z<S2, N2, Saturate> const& x, int n) noexcept;
+// q[0, n) = x[0, n) / y and r[0, n) = x[0, n) % y by Knuth's Algorithm D
+// (TAOCP 4.3.1), where v[0, yn) == y << s is the normalized divisor:  v[yn-1] has
+// its high bit set and vinv == reciprocal(v[yn-1]).  x is shifted by s on the fly.
+// q and r must not overlap x or v.
+template <unsigned n>
+constexpr
+void
+divrem_preinv(limb_t* q, limb_t* r, limb_t const* x, limb_t const* v, unsigned yn,
+              unsigned s, limb_t vinv) noexcept
+{
+    unsigned xn = n;
+    while (xn > 0 && x[xn-1] == 0)
+        --xn;
+    for (unsigned j = 0; j < n; ++j)
+    {
+        q[j] = 0;
+        r[j] = 0;
+    }
+    if (xn < yn)
+    {
+        for (unsigned j = 0; j < xn; ++j)
+            r[j] = x[j];
+        return;
+    }
+    if (yn == 1)
+    {
+        r[0] = divrem_1(q, x, xn, limb_t(v[0] >> s), s, vinv);
+        return;
+    }
+    std::array<limb_t, n+1> u;
+    if (s == 0)
+    {
+        for (unsigned j = 0; j < xn; ++j)
+            u[j] = x[j];
+        u[xn] = 0;
+    }
+    else
+        u[xn] = lshift_n(u.data(), x, xn, s);
 
-    template <SignTag S2, unsigned N2, ErrorCheckedPolicy P2>
-    friend
-    constexpr
-    Z<S2, N2, P2>
-    operator<<(Z<S2, N2, P2> const& x, int n) noexcept(P2{} == Terminate{});
+    auto const v1 = v[yn-1];
+    auto const v2 = v[yn-2];
+    for (unsigned j = xn - yn + 1; j-- > 0;)
+    {
+        // Estimate the quotient limb from the top two limbs of u[j, j+yn] and
+        // the top limb of v, then correct it with the next limb of v.
+        // The estimate is then at most one too large.
+        auto const u2 = u[j+yn];
+        auto const u1 = u[j+yn-1];
+        limb_t qhat;
+        limb_t rhat;
+        bool rhat_fits;
+        if (u2 >= v1)
+        {
+            qhat = limb_max;
+            rhat = limb_t(u1 + v1);
+            rhat_fits = rhat >= v1;
+        }
+        else
+        {
+            qhat = div_limb_preinv(u2, u1, v1, vinv, rhat);
+            rhat_fits = true;
+        }
+        while (rhat_fits)
+        {
+            limb_t hi;
+            auto const lo = mul_limb(qhat, v2, hi);
+            if (hi < rhat || (hi == rhat && lo <= u[j+yn-2]))
+                break;
+            --qhat;
+            rhat = limb_t(rhat + v1);
+            rhat_fits = rhat >= v1;
+        }
 
-    template <SignTag S2, unsigned N2>
-    friend
-    constexpr
-    Z<S2, N2, Wrap>
-    operator>>(Z<S2, N2, Wrap> const& x, int n) noexcept;
+        // u[j, j+yn] -= qhat * v, adding back if qhat was one too large
+        auto const borrow = submul_1(u.data()+j, v, yn, qhat);
+        if (u2 < borrow)
+        {
+            --qhat;
+            add_n(u.data()+j, u.data()+j, v, yn);
+        }
+        u[j+yn] = 0;
+        q[j] = qhat;
+    }
 
-    template <SignTag S2, unsigned N2>
-    friend
-    constexpr
-    Z<S2, N2, Saturate>
-    operator>>(Z<S2, N2, Saturate> const& x, int n) noexcept;
+    // The remainder is u[0, yn) >> s
+    if (s == 0)
+    {
+        for (unsigned j = 0; j < yn; ++j)
+            r[j] = u[j];
+    }
+    else
+        rshift_n(r, u.data(), yn, s);
+}
 
-    template <SignTag S2, unsigned N2, ErrorCheckedPolicy P2>
-    friend
-    constexpr
-    Z<S2, N2, P2>
-    operator>>(Z<S2, N2, P2> const& x, int n) noexcept(P2{} == Terminate{});
+// q[0, n) = x[0, n) / y[0, n) and r[0, n) = x[0, n) % y[0, n).  y must not be 0.
+// q and r must not overlap x or y.
+template <unsigned n>
+constexpr
+void
+divrem_n(limb_t* q, limb_t* r, limb_t const* x, limb_t const* y) noexcept
+{
+    unsigned yn = n;
+    while (y[yn-1] == 0)
+        --yn;
 
-    template <SignTag S2, unsigned N2, Policy P2>
-    friend
-    constexpr
-    Z<S2, N2, P2>
-    operator~(Z<S2, N2, P2> const& x) noexcept;
+    // Normalize so that the high bit of the divisor is set
+    auto const s = unsigned(std::countl_zero(y[yn-1]));
+    std::array<limb_t, n> v;
+    if (s == 0)
+    {
+        for (unsigned j = 0; j < yn; ++j)
+            v[j] = y[j];
+    }
+    else
+        lshift_n(v.data(), y, yn, s);
+    divrem_preinv<n>(q, r, x, v.data(), yn, s, reciprocal(v[yn-1]));
+}
 
-    template <SignTag S2, unsigned N2, Policy P2>
-    friend
-    constexpr
-    Z<S2, N2, P2>
-    operator&(Z<S2, N2, P2> const& x, Z<S2, N2, P2> const& y) noexcept;
+// Returns x / d and stores x % d in r, with s and v as for divrem_1.
+// Requires N > limb_bits.
+template <unsigned N>
+constexpr
+Z<Unsigned, N, Wrap>
+divrem_1(Z<Unsigned, N, Wrap> const& x, limb_t d, unsigned s, limb_t v, limb_t& r) noexcept;
 
-    template <SignTag S2, unsigned N2, Policy P2>
-    friend
-    constexpr
-    Z<S2, N2, P2>
-    operator^(Z<S2, N2, P2> const& x, Z<S2, N2, P2> const& y) noexcept;
+// The limbs of x, least significant first
+template <unsigned N>
+constexpr
+std::array<limb_t, (N + limb_bits - 1) / limb_bits>
+to_limbs(Z<Unsigned, N, Wrap> const& x) noexcept;
 
-    template <SignTag S2, unsigned N2, Policy P2>
-    friend
-    constexpr
-    Z<S2, N2, P2>
-    operator|(Z<S2, N2, P2> const& x, Z<S2, N2, P2> const& y) noexcept;
+// The value of a[0, (N + limb_bits - 1) / limb_bits), modulo 2^N
+template <unsigned N>
+constexpr
+Z<Unsigned, N, Wrap>
+from_limbs(limb_t const* a) noexcept;
 
-    template <SignTag S2, unsigned N2>
-    friend
-    constexpr
-    auto
-    operator+(Z<S2, N2, Wrap> const& x, Z<S2, N2, Wrap> const& y) noexcept
-        -> Z<S2, N2, Wrap>;
+// The value of the decimal digits d, negated if neg, with overflow reported by R's
+// policy.  d must not be empty and must contain only digits.
+template <class R>
+constexpr
+R
+from_decimal(std::string_view d, bool neg);
 
-    template <SignTag S2, unsigned N2>
-    friend
-    constexpr
-    auto
-    operator+(Z<S2, N2, Saturate> const& x, Z<S2, N2, Saturate> const& y) noexcept
-        -> Z<S2, N2, Saturate>;
+}  // namespace detail
 
-    template <SignTag S2, unsigned N2, ErrorCheckedPolicy P2>
-    friend
-    constexpr
-    auto
-    operator+(Z<S2, N2, P2> const& x, Z<S2, N2, P2> const& y)
-        noexcept(P2{} == Terminate{})
-        -> Z<S2, N2, P2>;
-
-    template <SignTag S2, unsigned N2>
-    friend
-    constexpr
-    auto
-    operator-(Z<S2, N2, Wrap> const& x, Z<S2, N2, Wrap> const& y) noexcept
-        -> Z<S2, N2, Wrap>;
-
-    template <SignTag S2, unsigned N2>
-    friend
-    constexpr
-    auto
-    operator-(Z<S2, N2, Wrap> const& x) noexcept
-        -> Z<S2, N2, Wrap>;
-
-    template <SignTag S2, unsigned N2>
-    friend
-    constexpr
-    auto
-    operator-(Z<S2, N2, Saturate> const& x, Z<S2, N2, Saturate> const& y) noexcept
-        -> Z<S2, N2, Saturate>;
-
-    template <SignTag S2, unsigned N2>
-    friend
-    constexpr
-    auto
-    operator-(Z<S2, N2, Saturate> const& x) noexcept
-        -> Z<S2, N2, Saturate>;
-
-    template <SignTag S2, unsigned N2, ErrorCheckedPolicy P2>
-    friend
-    constexpr
-    auto
-    operator-(Z<S2, N2, P2> const& x, Z<S2, N2, P2> const& y)
-        noexcept(P2{} == Terminate{})
-        -> Z<S2, N2, P2>;
-
-    template <SignTag S2, unsigned N2, ErrorCheckedPolicy P2>
-    friend
-    constexpr
-    auto
-    operator-(Z<S2, N2, P2> const& x) noexcept(P2{} == Terminate{})
-        -> Z<S2, N2, P2>;
-
-    template <SignTag S2, unsigned N2>
-    friend
-    constexpr
-    auto
-    operator*(Z<S2, N2, Wrap> const& x, Z<S2, N2, Wrap> const& y) noexcept
-        -> Z<S2, N2, Wrap>;
-
-    template <unsigned N2>
-    friend
-    constexpr
-    Z<Unsigned, 2*N2, Wrap>
-    detail::mul2(Z<Unsigned, N2, Wrap> const& x, Z<Unsigned, N2, Wrap> const& y)
-        noexcept;
-
-    template <unsigned N2>
-    friend
-    constexpr
-    Z<Signed, 2*N2, Wrap>
-    detail::mul2(Z<Signed, N2, Wrap> const& x, Z<Signed, N2, Wrap> const& y)
-        noexcept;
-
-    template <unsigned N2>
-    friend
-    constexpr
-    auto
-    operator/(Z<Unsigned, N2, Wrap> const& x,
-              Z<Unsigned, N2, Wrap> const& y) noexcept
-        -> Z<Unsigned, N2, Wrap>;
-
-    template <unsigned N2>
-    friend
-    constexpr
-    auto
-    operator/(Z<Signed, N2, Wrap> const& x, Z<Signed, N2, Wrap> const& y) noexcept
-        -> Z<Signed, N2, Wrap>;
-
-    template <unsigned N2, Policy P2>
-    friend
-    constexpr
-    unsigned
-    countl_zero(Z<Unsigned, N2, P2> const& x) noexcept;
-
-    template <unsigned N2, Policy P2>
-    friend
-    constexpr
-    unsigned
-    countr_zero(Z<Unsigned, N2, P2> const& x) noexcept;
-
-    template <unsigned N2, Policy P2>
-    friend
-    constexpr
-    unsigned
-    popcount(Z<Unsigned, N2, P2> const& x) noexcept;
-
-    template <unsigned N2>
-    requires(N2 <= Nlimit)
-    friend
-    constexpr
-    unsigned
-    detail::divu10(Z<Unsigned, N2, Wrap>& u) noexcept;
-
-    // Precondition:  0 <= n < N
-    constexpr Z left_shift(unsigned n) const noexcept
-    {
-        Z<S, N, P> r;
-        r.rep_ = urep_t(rep_ << n);
-        return r;
-    }
-
-    // Precondition:  0 <= n < N
-    constexpr Z right_shift_unsigned(unsigned n) const noexcept
-    {
-        Z<S, N, P> r;
-        r.rep_ = urep_t(rep_ >> n);
-        return r;
-    }
-
-    // Precondition:  0 <= n < N
-    constexpr Z right_shift_signed(unsigned n) const noexcept
-    {
-        Z<S, N, P> r;
-        r.rep_ = urep_t(srep_t(rep_) >> n);
-        return r;
-    }
-
-    constexpr
-    bool
-    high_bit() const noexcept
-    {
-        auto constexpr mask = urep_t(urep_t(1) << (N-1));
-        return bool(rep_ & mask);
-    }
-
-    constexpr
-    void
-    zero_high_bit() noexcept
-    {
-        urep_t constexpr mask = urep_t(~urep_t(urep_t(1) << (N-1)));
-        rep_ &= mask;
-    }
-
-    constexpr
-    void
-    set_high_bit() noexcept
-    {
-        urep_t constexpr mask = urep_t(urep_t(1) << (N-1));
-        rep_ |= mask;
-    }
-
-    constexpr
-    bool
-    is_neg() const noexcept
-    {
-        if constexpr (sign{} == Unsigned{})
-            return false;
-        else
-            return high_bit();
-    }
-
-    template <SignTag S2, unsigned N2, Policy P2>
-    static
-    constexpr
-    auto
-    sign_extend(Z<S2, N2, P2> const& y) noexcept
-    {
-        using X = Z<S2, N2, P2>;
-        if (y.is_neg())
-        {
-            auto constexpr ones = ~X{};
-            return ones;
-        }
-        auto constexpr zeroes = X{};
-        return zeroes;
-    }
-
-    static_assert(ProperIntSize<size>);
-};
-
-template <class Num, unsigned N, Policy P>
-constexpr
-Num
-power(Num const& f, Z<Unsigned, N, P> n);
+template <SignTag S, unsigned N, Policy P>
+std::string
+to_string(Z<S, N, P> const& x);
 
 template <SignTag S, unsigned N, Policy P>
-class Z<S, N, P, false>
+class Z<S, N, P, true>
 {
 public:
     using sign = S;
@@ -738,44 +1196,34 @@ public:
     using policy = P;
 
 private:
-    using utypes = std::tuple<std::uint8_t, std::uint16_t, std::uint32_t, std::uint64_t>;
-    using stypes = std::tuple< std::int8_t,  std::int16_t,  std::int32_t,  std::int64_t>;
-    template <unsigned N2>
-        using urep_t = std::tuple_element_t<std::countr_zero(N2)-3, utypes>;
-    template <unsigned N2>
-        using srep_t = std::tuple_element_t<std::countr_zero(N2)-3, stypes>;
-    template <SignTag S2, unsigned N2>
-        using rep = std::conditional_t<S2{} == Signed{}, srep_t<N2>, urep_t<N2>>;
-
-    using uhalf_t = Z<Unsigned, size/2, Wrap>;
-    using shalf_t = Z<  Signed, size/2, Wrap>;
+    using utypes = std::tuple<std::uint8_t, std::uint16_t, std::uint32_t, std::uint64_t
+#ifndef _MSC_VER
+                                                                        , __uint128_t
+#endif
+                                                                                       >;
+    using stypes = std::tuple< std::int8_t,  std::int16_t,  std::int32_t,  std::int64_t
+#ifndef _MSC_VER
+                                                                        , __int128_t
+#endif
+                                                                                       >;
+    using urep_t = std::tuple_element_t<std::countr_zero(size)-3, utypes>;
+    using srep_t = std::tuple_element_t<std::countr_zero(size)-3, stypes>;
 
-    uhalf_t lo_;
-    uhalf_t hi_;
+    urep_t rep_;
 
 public:
-    Z() = default;
+    using rep = std::conditional_t<sign{} == Signed{}, srep_t, urep_t>;
 
-    // Construct from integral type with bit with greater than uhalf_t
-    // Implicit if lossless, otherwise explicit
-    template <std::integral I>
-        requires (size < 2*sizeof(I)*CHAR_BIT)
-        constexpr
-        explicit(detail::ExplicitFromI<Z, I>)
-        Z(I i)
-            noexcept(detail::NoexceptFromI<Z, I>)
-            : lo_(i), hi_(i >> size/2)
-            {detail::check(*this, i);}
+    Z() = default;
 
-    // Construct from integral type with bit with less than or equal to uhalf_t
+    // Construct from integral type.
     // Implicit if lossless, otherwise explicit
     template <std::integral I>
-        requires (size >= 2*sizeof(I)*CHAR_BIT)
         constexpr
         explicit(detail::ExplicitFromI<Z, I>)
         Z(I i)
             noexcept(detail::NoexceptFromI<Z, I>)
-            : lo_(i), hi_(-(i < 0))
+            : rep_(i)
             {detail::check(*this, i);}
 
 #if BBI_FLOAT_CONVERT
@@ -784,87 +1232,65 @@ public:
         explicit
         Z(F f)
             noexcept(detail::NoexceptFromF<Z, F>)
-            : hi_(f/power(F{2}, uhalf_t{size/2}))
-            {
-                lo_ = uhalf_t(f - power(F{hi_}, uhalf_t{size/2}));
-                detail::check(*this, f);
-            }
+            : rep_(f)
+            {detail::check(*this, f);}
 #endif  // BBI_FLOAT_CONVERT
 
     // Construction from other Z
 
-    template <SignTag S2, unsigned N2, Policy P2>
-        requires (N2 < size/2)
-        explicit(detail::ExplicitFromZ<Z, Z<S2, N2, P2>>)
+    template <unsigned N2, Policy P2>
+        requires (N2 < size)
+        explicit(detail::ExplicitFromZ<Z, Z<Unsigned, N2, P2>>)
         constexpr
-        Z(Z<S2, N2, P2> const& x)
-            noexcept(detail::NoexceptFromZ<Z, Z<S2, N2, P2>>)
-            : Z{Z<S2, size/2, policy>{x}} {}
+        Z(Z<Unsigned, N2, P2> const& x)
+            noexcept(detail::NoexceptFromZ<Z, Z<Unsigned, N2, P2>>)
+            : rep_{x.rep_} {detail::check(*this, x);}
 
-    template <SignTag S2, unsigned N2, Policy P2>
-        requires (N2 == size/2)
-        explicit(detail::ExplicitFromZ<Z, Z<S2, N2, P2>>)
+    template <unsigned N2, Policy P2>
+        requires (N2 < size)
+        explicit(detail::ExplicitFromZ<Z, Z<Signed, N2, P2>>)
         constexpr
-        Z(Z<S2, N2, P2> const& x)
-            noexcept(detail::NoexceptFromZ<Z, Z<S2, N2, P2>>)
-            : lo_{x}, hi_{uhalf_t::sign_extend(x)} {detail::check(*this, x);}
+        Z(Z<Signed, N2, P2> const& x)
+            noexcept(detail::NoexceptFromZ<Z, Z<Signed, N2, P2>>)
+            : rep_(srep_t{typename Z<Signed, N2, P2>::srep_t(x.rep_)})
+              {detail::check(*this, x);}
 
     template <SignTag S2, Policy P2>
-        requires (sign{} != S2{} || P2{} != policy{})
+        requires (sign{} != S2{} || policy{} != P2{})
         explicit(detail::ExplicitFromZ<Z, Z<S2, size, P2>>)
         constexpr
         Z(Z<S2, size, P2> const& x)
             noexcept(detail::NoexceptFromZ<Z, Z<S2, size, P2>>)
-            : lo_{x.lo_}, hi_{x.hi_} {detail::check(*this, x);}
+            : rep_{x.rep_} {detail::check(*this, x);}
 
     template <SignTag S2, unsigned N2, Policy P2>
-        requires (N2 == size*2)
+        requires (N2 > size && N2 <= Nlimit)
         constexpr
         explicit(detail::ExplicitFromZ<Z, Z<S2, N2, P2>>)
         Z(Z<S2, N2, P2> const& x)
             noexcept(detail::NoexceptFromZ<Z, Z<S2, N2, P2>>)
-            : lo_{x.lo_.lo_}, hi_{x.lo_.hi_} {detail::check(*this, x);}
+            : rep_(x.rep_) {detail::check(*this, x);}
 
     template <SignTag S2, unsigned N2, Policy P2>
-        requires (N2 > size*2)
+        requires (Nlimit < N2)
         constexpr
         explicit(detail::ExplicitFromZ<Z, Z<S2, N2, P2>>)
         Z(Z<S2, N2, P2> const& x)
             noexcept(detail::NoexceptFromZ<Z, Z<S2, N2, P2>>)
-            : Z{Z<S2, size*2, policy>{x}} {}
-
-    explicit constexpr Z(uhalf_t hi, uhalf_t lo) noexcept : lo_{lo}, hi_{hi} {} 
+            : rep_(x.template low_bits<urep_t>()) {detail::check(*this, x);}
 
     explicit constexpr Z(std::string_view s);
     explicit constexpr Z(std::string_view s, unsigned& i);
     explicit operator std::string() const;
 
-    constexpr explicit operator bool() const noexcept {return bool(hi_ | lo_);}
-
-    template <std::integral I>
-        requires (size > sizeof(I)*CHAR_BIT*2)
-        constexpr explicit operator I() const noexcept
-            {return I(Z<sign, size/2, policy>{*this});}
-
-    template <std::integral I>
-        requires (size == sizeof(I)*CHAR_BIT*2)
-        constexpr explicit operator I() const noexcept {return I(lo_);}
-
-    template <std::integral I>
-        requires (size == sizeof(I)*CHAR_BIT)
-        constexpr explicit operator I() const noexcept
-            {return (I(urep_t<size/2>(hi_)) << size/2) | urep_t<size/2>(lo_);}
+    constexpr explicit operator bool() const noexcept {return bool(rep_);}
 
     template <std::integral I>
-        requires (size < sizeof(I)*CHAR_BIT)
-        constexpr explicit operator I() const noexcept
-            {return I(Z<sign, 2*size, policy>{*this});}
-
+        constexpr explicit operator I() const noexcept {return I(rep(rep_));}
 #if BBI_FLOAT_CONVERT
     template <std::floating_point F>
         constexpr
-        operator F() const noexcept
-            {return F{shalf_t(hi_)}*power(F{2}, uhalf_t{size/2}) + F{lo_};}
+        operator F() const noexcept {return F(rep(rep_));}
 #endif  // BBI_FLOAT_CONVERT
 
     constexpr Z operator+() noexcept {return *this;}
@@ -903,9 +1329,6 @@ public:
     constexpr Z& operator|=(Z const& y) noexcept(policy{} != Throw{})
         {*this = *this | y; return *this;}
 
-    constexpr uhalf_t low() const noexcept {return lo_;}
-    constexpr uhalf_t high() const noexcept {return hi_;}
-
 private:
     template <SignTag S2, unsigned N2, Policy P2, bool>
     friend
@@ -929,11 +1352,19 @@ private:
     void
     detail::check(Z<S1, N1, P1>& r, I i) noexcept (P1{} != Throw{});
 
-    template <SignTag S1, unsigned N1, Policy P1, SignTag S2, unsigned N2, Policy P2>
+#if BBI_FLOAT_CONVERT
+    template <SignTag S1, unsigned N1, Policy P1, std::floating_point F>
     friend
     constexpr
     void
-    detail::check(Z<S1, N1, P1>& r, Z<S2, N2, P2> const& x)
+    detail::check(Z<S1, N1, P1>& r, F i) noexcept (P1{} != Throw{});
+#endif  // BBI_FLOAT_CONVERT
+
+    template <SignTag S1, unsigned N1, Policy P1, SignTag S2, unsigned N2, Policy P2>
+    friend
+    constexpr
+    void
+    detail::check(Z<S1, N1, P1>& r, Z<S2, N2, P2> const& x)
         noexcept (P1{} != Throw{});
 
     template <SignTag S2, unsigned N2, Policy P2>
@@ -948,12 +1379,6 @@ private:
     bool
     operator<(Z<S2, N2, P2> const& x, Z<S2, N2, P2> const& y) noexcept;
 
-    template <SignTag S2, unsigned N2, Policy P2>
-    friend
-    constexpr
-    Z<S2, N2, P2>
-    operator~(Z<S2, N2, P2> const& x) noexcept;
-
     template <SignTag S2, unsigned N2>
     friend
     constexpr
@@ -990,6 +1415,12 @@ private:
     Z<S2, N2, P2>
     operator>>(Z<S2, N2, P2> const& x, int n) noexcept(P2{} == Terminate{});
 
+    template <SignTag S2, unsigned N2, Policy P2>
+    friend
+    constexpr
+    Z<S2, N2, P2>
+    operator~(Z<S2, N2, P2> const& x) noexcept;
+
     template <SignTag S2, unsigned N2, Policy P2>
     friend
     constexpr
@@ -1037,6 +1468,13 @@ private:
     operator-(Z<S2, N2, Wrap> const& x, Z<S2, N2, Wrap> const& y) noexcept
         -> Z<S2, N2, Wrap>;
 
+    template <SignTag S2, unsigned N2>
+    friend
+    constexpr
+    auto
+    operator-(Z<S2, N2, Wrap> const& x) noexcept
+        -> Z<S2, N2, Wrap>;
+
     template <SignTag S2, unsigned N2>
     friend
     constexpr
@@ -1087,6 +1525,46 @@ private:
     detail::mul2(Z<Signed, N2, Wrap> const& x, Z<Signed, N2, Wrap> const& y)
         noexcept;
 
+    template <unsigned N2>
+    friend
+    constexpr
+    Z<Unsigned, 2*N2, Wrap>
+    detail::sqr2(Z<Unsigned, N2, Wrap> const& x) noexcept;
+
+    template <unsigned N2>
+    friend
+    constexpr
+    Z<Signed, 2*N2, Wrap>
+    detail::sqr2(Z<Signed, N2, Wrap> const& x) noexcept;
+
+    template <SignTag S2, unsigned N2>
+    friend
+    constexpr
+    auto
+    divmod(Z<S2, N2, Wrap> const& x, Z<S2, N2, Wrap> const& y) noexcept
+        -> div_t<Z<S2, N2, Wrap>>;
+
+    template <unsigned N2>
+    friend
+    constexpr
+    Z<Unsigned, N2, Wrap>
+    detail::divrem_1(Z<Unsigned, N2, Wrap> const& x, detail::limb_t d, unsigned s,
+                     detail::limb_t v, detail::limb_t& r) noexcept;
+
+    template <unsigned N2>
+    friend
+    constexpr
+    std::array<detail::limb_t, (N2 + detail::limb_bits - 1) / detail::limb_bits>
+    detail::to_limbs(Z<Unsigned, N2, Wrap> const& x) noexcept;
+
+    template <unsigned N2>
+    friend
+    constexpr
+    Z<Unsigned, N2, Wrap>
+    detail::from_limbs(detail::limb_t const* a) noexcept;
+
+    template <class T> friend class divider;
+
     template <unsigned N2>
     friend
     constexpr
@@ -1123,61 +1601,24 @@ private:
     // Precondition:  0 <= n < N
     constexpr Z left_shift(unsigned n) const noexcept
     {
-        if (n == 0)
-            return *this;
-        Z r;
-        if (n < N/2)
-        {
-            r.lo_ = lo_.left_shift(n);
-            r.hi_ = hi_.left_shift(n) | lo_.right_shift_unsigned(N/2 - n);
-        }
-        else
-        {
-            auto constexpr zeroes = uhalf_t{};
-            r.lo_ = zeroes;
-            r.hi_ = lo_.left_shift(n - N/2);
-        }
+        Z<S, N, P> r;
+        r.rep_ = urep_t(rep_ << n);
         return r;
     }
 
     // Precondition:  0 <= n < N
     constexpr Z right_shift_unsigned(unsigned n) const noexcept
     {
-        if (n == 0)
-            return *this;
-        Z r;
-        if (n < N/2)
-        {
-            r.lo_ = hi_.left_shift(N/2 - n) | lo_.right_shift_unsigned(n);
-            r.hi_ = hi_.right_shift_unsigned(n);
-        }
-        else
-        {
-            auto constexpr zeroes = uhalf_t{};
-            r.lo_ = hi_.right_shift_unsigned(n - N/2);
-            r.hi_ = zeroes;
-        }
+        Z<S, N, P> r;
+        r.rep_ = urep_t(rep_ >> n);
         return r;
     }
 
     // Precondition:  0 <= n < N
     constexpr Z right_shift_signed(unsigned n) const noexcept
     {
-        if (n == 0)
-            return *this;
-        Z r;
-        if (n < N/2)
-        {
-            r.lo_ = hi_.left_shift(N/2 - n) | lo_.right_shift_unsigned(n);
-            r.hi_ = hi_.right_shift_signed(n);
-        }
-        else
-        {
-            r.lo_ = hi_.right_shift_signed(n - N/2);
-            auto constexpr ones = ~uhalf_t{};
-            auto constexpr zeroes = uhalf_t{};
-            r.hi_ = hi_.high_bit() ? ones : zeroes;
-        }
+        Z<S, N, P> r;
+        r.rep_ = urep_t(srep_t(rep_) >> n);
         return r;
     }
 
@@ -1185,21 +1626,24 @@ private:
     bool
     high_bit() const noexcept
     {
-        return hi_.high_bit();
+        auto constexpr mask = urep_t(urep_t(1) << (N-1));
+        return bool(rep_ & mask);
     }
 
     constexpr
     void
     zero_high_bit() noexcept
     {
-        hi_.zero_high_bit();
+        urep_t constexpr mask = urep_t(~urep_t(urep_t(1) << (N-1)));
+        rep_ &= mask;
     }
 
     constexpr
     void
     set_high_bit() noexcept
     {
-        hi_.set_high_bit();
+        urep_t constexpr mask = urep_t(urep_t(1) << (N-1));
+        rep_ |= mask;
     }
 
     constexpr
@@ -1212,2864 +1656,5546 @@ private:
             return high_bit();
     }
 
-    template <SignTag S2, unsigned N2, Policy P2>
-    static
-    constexpr
-    auto
-    sign_extend(Z<S2, N2, P2> const& y) noexcept
-    {
-        using X = Z<sign, size, policy>;
-        if (y.is_neg())
-        {
-            auto constexpr ones = ~X{};
-            return ones;
-        }
-        auto constexpr zeroes = X{};
-        return zeroes;
-    }
-
     static_assert(ProperIntSize<size>);
 };
 
-}  // namespace bbi
+template <class Num, unsigned N, Policy P>
+constexpr
+Num
+power(Num const& f, Z<Unsigned, N, P> n);
 
-namespace std
+template <SignTag S, unsigned N, Policy P>
+class Z<S, N, P, false>
 {
+public:
+    using sign = S;
+    static constexpr auto size = N;
+    using policy = P;
 
-template <unsigned N1, unsigned N2, bbi::Policy P>
-struct common_type<bbi::Z<bbi::Unsigned, N1, P>, bbi::Z<bbi::Signed, N2, P>>
-{
-    using type = bbi::Z<bbi::Signed, std::max(2*N1, N2), P>;
-};
+private:
+    using uhalf_t = Z<Unsigned, size/2, Wrap>;
 
-template <unsigned N1, unsigned N2, bbi::Policy P>
-struct common_type<bbi::Z<bbi::Signed, N1, P>, bbi::Z<bbi::Unsigned, N2, P>>
-{
-    using type = bbi::Z<bbi::Signed, std::max(N1, 2*N2), P>;
-};
+    using limb_t = detail::limb_t;
+    static constexpr unsigned limb_bits = detail::limb_bits;
+    static constexpr unsigned nlimbs = size/limb_bits;
 
-template <bbi::SignTag S, unsigned N, bbi::Policy P, bbi::detail::StandardInteger I>
-struct common_type<bbi::Z<S, N, P>, I>
-{
-    using type = conditional_t<(S{} == bbi::Signed{}) == is_signed_v<I>
-        , bbi::Z<S, max<size_t>(N, sizeof(I)*CHAR_BIT), P>
-        , bbi::Z<bbi::Signed, S{} == bbi::Signed{}
-                                     ? max<size_t>(N, 2*sizeof(I)*CHAR_BIT)
-                                     : max<size_t>(2*N, sizeof(I)*CHAR_BIT)
-        , P>>;
-};
+    std::array<limb_t, nlimbs> limbs_;
 
-template <bbi::SignTag S, unsigned N, bbi::Policy P, bbi::detail::StandardInteger I>
-struct common_type<I, bbi::Z<S, N, P>>
-{
-    using type = common_type_t<bbi::Z<S, N, P>, I>;
-};
+public:
+    Z() = default;
 
-#if BBI_FLOAT_CONVERT
-template <bbi::SignTag S, unsigned N, bbi::Policy P, floating_point F>
-struct common_type<bbi::Z<S, N, P>, F>
-{
-    using type = F;
-};
+    // Construct from integral type
+    // Implicit if lossless, otherwise explicit
+    template <std::integral I>
+        constexpr
+        explicit(detail::ExplicitFromI<Z, I>)
+        Z(I i)
+            noexcept(detail::NoexceptFromI<Z, I>)
+            : limbs_{}
+            {assign(i); detail::check(*this, i);}
 
-template <bbi::SignTag S, unsigned N, bbi::Policy P, floating_point F>
-struct common_type<F, bbi::Z<S, N, P>>
-{
-    using type = common_type_t<bbi::Z<S, N, P>, F>;
-};
+#if BBI_FLOAT_CONVERT
+    template <std::floating_point F>
+        constexpr
+        explicit
+        Z(F f)
+            noexcept(detail::NoexceptFromF<Z, F>)
+            : limbs_{}
+            {
+                auto constexpr b = F(detail::limb_max) + F{1};
+                auto const neg = f < F{0};
+                auto a = neg ? -f : f;
+                F scale{1};
+                for (unsigned j = 1; j < nlimbs; ++j)
+                    scale *= b;
+                for (unsigned j = nlimbs; j-- > 0; scale /= b)
+                {
+                    auto const l = limb_t(a/scale);
+                    a -= F(l)*scale;
+                    limbs_[j] = l;
+                }
+                if (neg)
+                {
+                    limb_t c{1};
+                    for (auto& l : limbs_)
+                    {
+                        l = limb_t(~l + c);
+                        c = c && l == 0;
+                    }
+                }
+                detail::check(*this, f);
+            }
 #endif  // BBI_FLOAT_CONVERT
 
-template <bbi::SignTag S, unsigned N, bbi::Policy P>
-class numeric_limits<bbi::Z<S, N, P>>
-{
-    using type = bbi::Z<S, N, P>;
+    // Construction from other Z
 
-public:
-    static constexpr bool is_specialized = true;
+    template <SignTag S2, unsigned N2, Policy P2>
+        requires (N2 <= Nlimit)
+        explicit(detail::ExplicitFromZ<Z, Z<S2, N2, P2>>)
+        constexpr
+        Z(Z<S2, N2, P2> const& x)
+            noexcept(detail::NoexceptFromZ<Z, Z<S2, N2, P2>>)
+            : limbs_{}
+            {assign(typename Z<S2, N2, P2>::rep(x.rep_)); detail::check(*this, x);}
 
-    static constexpr type min() noexcept
+    template <SignTag S2, unsigned N2, Policy P2>
+        requires (Nlimit < N2 && (N2 != size || sign{} != S2{} || P2{} != policy{}))
+        explicit(detail::ExplicitFromZ<Z, Z<S2, N2, P2>>)
+        constexpr
+        Z(Z<S2, N2, P2> const& x)
+            noexcept(detail::NoexceptFromZ<Z, Z<S2, N2, P2>>)
+            : limbs_{}
+            {
+                auto constexpr n = std::min(nlimbs, Z<S2, N2, P2>::nlimbs);
+                for (unsigned j = 0; j < n; ++j)
+                    limbs_[j] = x.limbs_[j];
+                if constexpr (n < nlimbs)
+                {
+                    auto const fill = x.is_neg() ? detail::limb_max : limb_t{};
+                    for (unsigned j = n; j < nlimbs; ++j)
+                        limbs_[j] = fill;
+                }
+                detail::check(*this, x);
+            }
+
+    explicit constexpr Z(uhalf_t hi, uhalf_t lo) noexcept
+        : limbs_{(Z<Unsigned, size, Wrap>{hi}.left_shift(size/2) |
+                  Z<Unsigned, size, Wrap>{lo}).limbs_}
+        {}
+
+    explicit constexpr Z(std::string_view s);
+    explicit constexpr Z(std::string_view s, unsigned& i);
+    explicit operator std::string() const;
+
+    constexpr
+    explicit
+    operator bool() const noexcept
     {
-        if constexpr (S{} == bbi::Signed{})
-        {
-            auto constexpr z = bbi::detail::set_high_bit(type{});
-            return z;
-        }
-        else
-        {
-            auto constexpr z = type{};
-            return z;
-        }
+        for (auto l : limbs_)
+            if (l)
+                return true;
+        return false;
     }
 
-    static constexpr type max() noexcept
-    {
-        if constexpr (S{} == bbi::Signed{})
+    template <std::integral I>
+        constexpr
+        explicit
+        operator I() const noexcept
         {
-            auto constexpr z = bbi::detail::zero_high_bit(~type{});
-            return z;
+            if constexpr (std::is_same_v<I, bool>)
+                return bool(*this);
+            else
+            {
+                using U = std::make_unsigned_t<I>;
+                auto u = low_bits<U>();
+                if constexpr (size < sizeof(I)*CHAR_BIT)
+                {
+                    if (is_neg())
+                        u |= U(~U{} << size);
+                }
+                return I(u);
+            }
         }
-        else
+
+#if BBI_FLOAT_CONVERT
+    template <std::floating_point F>
+        constexpr
+        operator F() const noexcept
         {
-            auto constexpr z = ~type{};
-            return z;
+            auto constexpr b = F(detail::limb_max) + F{1};
+            auto const neg = is_neg();
+            Z<Unsigned, size, Wrap> u{*this};
+            if (neg)
+                u = -u;
+            F r{};
+            for (unsigned j = nlimbs; j-- > 0;)
+                r = r*b + F(u.limbs_[j]);
+            return neg ? -r : r;
         }
-    }
+#endif  // BBI_FLOAT_CONVERT
 
-    static constexpr type lowest() noexcept {return min();}
+    constexpr Z operator+() noexcept {return *this;}
+    constexpr Z& operator++() noexcept(policy{} != Throw{})
+        {*this += Z{1}; return *this;}
+    constexpr Z operator++(int) noexcept(policy{} != Throw{})
+        {auto t(*this); ++(*this); return t;}
 
-    static constexpr bool is_signed = S{} == bbi::Signed{};
-    static constexpr int  digits = static_cast<int>(N - is_signed);
-    static constexpr int  digits10 = static_cast<int>((N - is_signed)*76573ULL/254370);
-    static constexpr int  max_digits10 = 0;
-    static constexpr bool is_integer = true;
-    static constexpr bool is_exact = true;
-    static constexpr int  radix = 2;
-    static constexpr type epsilon() noexcept {return type{};}
-    static constexpr type round_error() noexcept {return type{};}
+    constexpr Z& operator--() noexcept(policy{} != Throw{})
+        {*this -= Z{1}; return *this;}
+    constexpr Z operator--(int) noexcept(policy{} != Throw{})
+        {auto t(*this); --(*this); return t;}
 
-    static constexpr int  min_exponent   = 0;
-    static constexpr int  min_exponent10 = 0;
-    static constexpr int  max_exponent   = 0;
-    static constexpr int  max_exponent10 = 0;
+    constexpr Z& operator+=(Z const& x) noexcept(policy{} != Throw{})
+        {*this = *this + x; return *this;}
+    constexpr Z& operator-=(Z const& x) noexcept(policy{} != Throw{})
+        {*this = *this - x; return *this;}
+    constexpr Z& operator*=(Z const& x) noexcept(policy{} != Throw{})
+        {*this = *this * x; return *this;}
+    constexpr Z& operator/=(Z const& x) noexcept(policy{} != Throw{})
+        {*this = *this / x; return *this;}
+    constexpr Z& operator%=(Z const& x) noexcept(policy{} != Throw{})
+        {*this = *this % x; return *this;}
+    constexpr Z& operator<<=(int n) noexcept(policy{} != Throw{})
+        {*this = *this << n; return *this;}
+    constexpr Z& operator<<=(Z const& n) noexcept(policy{} != Throw{})
+        {*this = *this << n; return *this;}
+    constexpr Z& operator>>=(int n) noexcept(policy{} != Throw{})
+        {*this = *this >> n; return *this;}
+    constexpr Z& operator>>=(Z const& n) noexcept(policy{} != Throw{})
+        {*this = *this >> n; return *this;}
+    constexpr Z& operator&=(Z const& y) noexcept(policy{} != Throw{})
+        {*this = *this & y; return *this;}
+    constexpr Z& operator^=(Z const& y) noexcept(policy{} != Throw{})
+        {*this = *this ^ y; return *this;}
+    constexpr Z& operator|=(Z const& y) noexcept(policy{} != Throw{})
+        {*this = *this | y; return *this;}
+
+    constexpr uhalf_t low() const noexcept
+        {return uhalf_t{Z<Unsigned, size, Wrap>{*this}};}
+    constexpr uhalf_t high() const noexcept
+        {return uhalf_t{Z<Unsigned, size, Wrap>{*this}.right_shift_unsigned(size/2)};}
+
+private:
+    template <SignTag S2, unsigned N2, Policy P2, bool>
+    friend
+    class Z;
+
+    template <SignTag S1, unsigned N1, Policy P1>
+    friend
+    constexpr
+    Z<S1, N1, P1>
+    detail::zero_high_bit(Z<S1, N1, P1> x) noexcept;
+
+    template <SignTag S1, unsigned N1, Policy P1>
+    friend
+    constexpr
+    Z<S1, N1, P1>
+    detail::set_high_bit(Z<S1, N1, P1> x) noexcept;
+
+    template <SignTag S1, unsigned N1, Policy P1, std::integral I>
+    friend
+    constexpr
+    void
+    detail::check(Z<S1, N1, P1>& r, I i) noexcept (P1{} != Throw{});
+
+    template <SignTag S1, unsigned N1, Policy P1, SignTag S2, unsigned N2, Policy P2>
+    friend
+    constexpr
+    void
+    detail::check(Z<S1, N1, P1>& r, Z<S2, N2, P2> const& x)
+        noexcept (P1{} != Throw{});
+
+    template <SignTag S2, unsigned N2, Policy P2>
+    friend
+    constexpr
+    bool
+    operator==(Z<S2, N2, P2> const& x, Z<S2, N2, P2> const& y) noexcept;
+
+    template <SignTag S2, unsigned N2, Policy P2>
+    friend
+    constexpr
+    bool
+    operator<(Z<S2, N2, P2> const& x, Z<S2, N2, P2> const& y) noexcept;
+
+    template <SignTag S2, unsigned N2, Policy P2>
+    friend
+    constexpr
+    Z<S2, N2, P2>
+    operator~(Z<S2, N2, P2> const& x) noexcept;
+
+    template <SignTag S2, unsigned N2>
+    friend
+    constexpr
+    Z<S2, N2, Wrap>
+    operator<<(Z<S2, N2, Wrap> const& x, int n) noexcept;
+
+    template <SignTag S2, unsigned N2>
+    friend
+    constexpr
+    Z<S2, N2, Saturate>
+    operator<<(Z<S2, N2, Saturate> const& x, int n) noexcept;
+
+    template <SignTag S2, unsigned N2, ErrorCheckedPolicy P2>
+    friend
+    constexpr
+    Z<S2, N2, P2>
+    operator<<(Z<S2, N2, P2> const& x, int n) noexcept(P2{} == Terminate{});
+
+    template <SignTag S2, unsigned N2>
+    friend
+    constexpr
+    Z<S2, N2, Wrap>
+    operator>>(Z<S2, N2, Wrap> const& x, int n) noexcept;
+
+    template <SignTag S2, unsigned N2>
+    friend
+    constexpr
+    Z<S2, N2, Saturate>
+    operator>>(Z<S2, N2, Saturate> const& x, int n) noexcept;
+
+    template <SignTag S2, unsigned N2, ErrorCheckedPolicy P2>
+    friend
+    constexpr
+    Z<S2, N2, P2>
+    operator>>(Z<S2, N2, P2> const& x, int n) noexcept(P2{} == Terminate{});
+
+    template <SignTag S2, unsigned N2, Policy P2>
+    friend
+    constexpr
+    Z<S2, N2, P2>
+    operator&(Z<S2, N2, P2> const& x, Z<S2, N2, P2> const& y) noexcept;
+
+    template <SignTag S2, unsigned N2, Policy P2>
+    friend
+    constexpr
+    Z<S2, N2, P2>
+    operator^(Z<S2, N2, P2> const& x, Z<S2, N2, P2> const& y) noexcept;
+
+    template <SignTag S2, unsigned N2, Policy P2>
+    friend
+    constexpr
+    Z<S2, N2, P2>
+    operator|(Z<S2, N2, P2> const& x, Z<S2, N2, P2> const& y) noexcept;
+
+    template <SignTag S2, unsigned N2>
+    friend
+    constexpr
+    auto
+    operator+(Z<S2, N2, Wrap> const& x, Z<S2, N2, Wrap> const& y) noexcept
+        -> Z<S2, N2, Wrap>;
+
+    template <SignTag S2, unsigned N2>
+    friend
+    constexpr
+    auto
+    operator+(Z<S2, N2, Saturate> const& x, Z<S2, N2, Saturate> const& y) noexcept
+        -> Z<S2, N2, Saturate>;
+
+    template <SignTag S2, unsigned N2, ErrorCheckedPolicy P2>
+    friend
+    constexpr
+    auto
+    operator+(Z<S2, N2, P2> const& x, Z<S2, N2, P2> const& y)
+        noexcept(P2{} == Terminate{})
+        -> Z<S2, N2, P2>;
+
+    template <SignTag S2, unsigned N2>
+    friend
+    constexpr
+    auto
+    operator-(Z<S2, N2, Wrap> const& x, Z<S2, N2, Wrap> const& y) noexcept
+        -> Z<S2, N2, Wrap>;
+
+    template <SignTag S2, unsigned N2>
+    friend
+    constexpr
+    auto
+    operator-(Z<S2, N2, Saturate> const& x, Z<S2, N2, Saturate> const& y) noexcept
+        -> Z<S2, N2, Saturate>;
+
+    template <SignTag S2, unsigned N2>
+    friend
+    constexpr
+    auto
+    operator-(Z<S2, N2, Saturate> const& x) noexcept
+        -> Z<S2, N2, Saturate>;
+
+    template <SignTag S2, unsigned N2, ErrorCheckedPolicy P2>
+    friend
+    constexpr
+    auto
+    operator-(Z<S2, N2, P2> const& x, Z<S2, N2, P2> const& y)
+        noexcept(P2{} == Terminate{})
+        -> Z<S2, N2, P2>;
+
+    template <SignTag S2, unsigned N2, ErrorCheckedPolicy P2>
+    friend
+    constexpr
+    auto
+    operator-(Z<S2, N2, P2> const& x) noexcept(P2{} == Terminate{})
+        -> Z<S2, N2, P2>;
+
+    template <SignTag S2, unsigned N2>
+    friend
+    constexpr
+    auto
+    operator*(Z<S2, N2, Wrap> const& x, Z<S2, N2, Wrap> const& y) noexcept
+        -> Z<S2, N2, Wrap>;
+
+    template <unsigned N2>
+    friend
+    constexpr
+    Z<Unsigned, 2*N2, Wrap>
+    detail::mul2(Z<Unsigned, N2, Wrap> const& x, Z<Unsigned, N2, Wrap> const& y)
+        noexcept;
+
+    template <unsigned N2>
+    friend
+    constexpr
+    Z<Signed, 2*N2, Wrap>
+    detail::mul2(Z<Signed, N2, Wrap> const& x, Z<Signed, N2, Wrap> const& y)
+        noexcept;
+
+    template <unsigned N2>
+    friend
+    constexpr
+    Z<Unsigned, 2*N2, Wrap>
+    detail::sqr2(Z<Unsigned, N2, Wrap> const& x) noexcept;
+
+    template <unsigned N2>
+    friend
+    constexpr
+    Z<Signed, 2*N2, Wrap>
+    detail::sqr2(Z<Signed, N2, Wrap> const& x) noexcept;
+
+    template <SignTag S2, unsigned N2>
+    friend
+    constexpr
+    auto
+    divmod(Z<S2, N2, Wrap> const& x, Z<S2, N2, Wrap> const& y) noexcept
+        -> div_t<Z<S2, N2, Wrap>>;
+
+    template <unsigned N2>
+    friend
+    constexpr
+    Z<Unsigned, N2, Wrap>
+    detail::divrem_1(Z<Unsigned, N2, Wrap> const& x, detail::limb_t d, unsigned s,
+                     detail::limb_t v, detail::limb_t& r) noexcept;
+
+    template <unsigned N2>
+    friend
+    constexpr
+    std::array<detail::limb_t, (N2 + detail::limb_bits - 1) / detail::limb_bits>
+    detail::to_limbs(Z<Unsigned, N2, Wrap> const& x) noexcept;
+
+    template <unsigned N2>
+    friend
+    constexpr
+    Z<Unsigned, N2, Wrap>
+    detail::from_limbs(detail::limb_t const* a) noexcept;
+
+    template <class T> friend class divider;
+
+    template <unsigned N2>
+    friend
+    constexpr
+    auto
+    operator/(Z<Unsigned, N2, Wrap> const& x,
+              Z<Unsigned, N2, Wrap> const& y) noexcept
+        -> Z<Unsigned, N2, Wrap>;
+
+    template <unsigned N2>
+    friend
+    constexpr
+    auto
+    operator/(Z<Signed, N2, Wrap> const& x, Z<Signed, N2, Wrap> const& y) noexcept
+        -> Z<Signed, N2, Wrap>;
+
+    template <unsigned N2, Policy P2>
+    friend
+    constexpr
+    unsigned
+    countl_zero(Z<Unsigned, N2, P2> const& x) noexcept;
+
+    template <unsigned N2, Policy P2>
+    friend
+    constexpr
+    unsigned
+    countr_zero(Z<Unsigned, N2, P2> const& x) noexcept;
+
+    template <unsigned N2, Policy P2>
+    friend
+    constexpr
+    unsigned
+    popcount(Z<Unsigned, N2, P2> const& x) noexcept;
+
+    // Store i, sign-extended if I is signed, else zero-extended
+    template <class I>
+    constexpr
+    void
+    assign(I i) noexcept
+    {
+        for (auto& l : limbs_)
+        {
+            l = limb_t(i);
+            if constexpr (sizeof(I)*CHAR_BIT > limb_bits)
+                i >>= limb_bits;
+            else if constexpr (std::is_signed_v<I>)
+                i = i < 0 ? I(-1) : I(0);
+            else
+                i = I(0);
+        }
+    }
+
+    // The low bits of *this that fit in the unsigned type U
+    template <class U>
+    constexpr
+    U
+    low_bits() const noexcept
+    {
+        unsigned constexpr ubits = sizeof(U)*CHAR_BIT;
+        if constexpr (ubits <= limb_bits)
+            return U(limbs_[0]);
+        else
+        {
+            U u{};
+            for (unsigned j = std::min(nlimbs, ubits/limb_bits); j-- > 0;)
+                u = U(u << limb_bits) | U(limbs_[j]);
+            return u;
+        }
+    }
+
+    // *this + y and *this - y, modulo 2^N.  These are out of line of the
+    // operators' if constexpr dispatch so that r is constructed in place.
+    constexpr Z add(Z const& y) const noexcept
+    {
+        Z r;
+        detail::add_n(r.limbs_.data(), limbs_.data(), y.limbs_.data(), nlimbs);
+        return r;
+    }
+
+    constexpr Z sub(Z const& y) const noexcept
+    {
+        Z r;
+        detail::sub_n(r.limbs_.data(), limbs_.data(), y.limbs_.data(), nlimbs);
+        return r;
+    }
+
+    // *this * y modulo 2^N
+    constexpr Z mullo(Z const& y) const noexcept
+    {
+        Z r;
+        detail::mullo_n<nlimbs>(r.limbs_.data(), limbs_.data(), y.limbs_.data());
+        return r;
+    }
+
+    // Returns *this / d and stores *this % d in r, with s and v as for detail::divrem_1
+    constexpr Z divrem_1(limb_t d, unsigned s, limb_t v, limb_t& r) const noexcept
+    {
+        Z q;
+        r = detail::divrem_1(q.limbs_.data(), limbs_.data(), nlimbs, d, s, v);
+        return q;
+    }
+
+    // Returns *this / y and stores *this % y in r.  Precondition:  y != 0
+    constexpr Z divrem(Z const& y, Z& r) const noexcept
+    {
+        Z q;
+        detail::divrem_n<nlimbs>(q.limbs_.data(), r.limbs_.data(),
+                                 limbs_.data(), y.limbs_.data());
+        return q;
+    }
+
+    // Precondition:  0 <= n < N
+    constexpr Z left_shift(unsigned n) const noexcept
+    {
+        Z r;
+        auto const q = n / limb_bits;
+        auto const s = n % limb_bits;
+        for (unsigned j = 0; j < q; ++j)
+            r.limbs_[j] = 0;
+        if (s == 0)
+        {
+            for (unsigned j = q; j < nlimbs; ++j)
+                r.limbs_[j] = limbs_[j-q];
+        }
+        else if (q < nlimbs)  // always, but lets the compiler see the bound
+        {
+            r.limbs_[q] = limb_t(limbs_[0] << s);
+            for (unsigned j = q+1; j < nlimbs; ++j)
+                r.limbs_[j] = limb_t(limbs_[j-q] << s) |
+                              limb_t(limbs_[j-q-1] >> (limb_bits - s));
+        }
+        return r;
+    }
+
+    // Precondition:  0 <= n < N
+    // The vacated high order limbs are filled with fill
+    constexpr Z right_shift(unsigned n, limb_t fill) const noexcept
+    {
+        Z r;
+        auto const q = n / limb_bits;
+        auto const s = n % limb_bits;
+        auto const m = nlimbs - q;
+        if (s == 0)
+        {
+            for (unsigned j = 0; j < m; ++j)
+                r.limbs_[j] = limbs_[j+q];
+        }
+        else
+        {
+            for (unsigned j = 0; j+1 < m; ++j)
+                r.limbs_[j] = limb_t(limbs_[j+q] >> s) |
+                              limb_t(limbs_[j+q+1] << (limb_bits - s));
+            r.limbs_[m-1] = limb_t(limbs_[nlimbs-1] >> s) |
+                            limb_t(fill << (limb_bits - s));
+        }
+        for (unsigned j = m; j < nlimbs; ++j)
+            r.limbs_[j] = fill;
+        return r;
+    }
+
+    // Precondition:  0 <= n < N
+    constexpr Z right_shift_unsigned(unsigned n) const noexcept
+    {
+        return right_shift(n, limb_t{});
+    }
+
+    // Precondition:  0 <= n < N
+    constexpr Z right_shift_signed(unsigned n) const noexcept
+    {
+        return right_shift(n, high_bit() ? detail::limb_max : limb_t{});
+    }
+
+    constexpr
+    bool
+    high_bit() const noexcept
+    {
+        return limbs_[nlimbs-1] >> (limb_bits-1);
+    }
+
+    constexpr
+    void
+    zero_high_bit() noexcept
+    {
+        limbs_[nlimbs-1] &= limb_t(detail::limb_max >> 1);
+    }
+
+    constexpr
+    void
+    set_high_bit() noexcept
+    {
+        limbs_[nlimbs-1] |= limb_t(~(detail::limb_max >> 1));
+    }
+
+    constexpr
+    bool
+    is_neg() const noexcept
+    {
+        if constexpr (sign{} == Unsigned{})
+            return false;
+        else
+            return high_bit();
+    }
+
+    static_assert(ProperIntSize<size>);
+};
+
+}  // namespace bbi
+
+namespace std
+{
+
+template <unsigned N1, unsigned N2, bbi::Policy P>
+struct common_type<bbi::Z<bbi::Unsigned, N1, P>, bbi::Z<bbi::Signed, N2, P>>
+{
+    using type = bbi::Z<bbi::Signed, std::max(2*N1, N2), P>;
+};
+
+template <unsigned N1, unsigned N2, bbi::Policy P>
+struct common_type<bbi::Z<bbi::Signed, N1, P>, bbi::Z<bbi::Unsigned, N2, P>>
+{
+    using type = bbi::Z<bbi::Signed, std::max(N1, 2*N2), P>;
+};
+
+template <bbi::SignTag S, unsigned N, bbi::Policy P, bbi::detail::StandardInteger I>
+struct common_type<bbi::Z<S, N, P>, I>
+{
+    using type = conditional_t<(S{} == bbi::Signed{}) == is_signed_v<I>
+        , bbi::Z<S, max<size_t>(N, sizeof(I)*CHAR_BIT), P>
+        , bbi::Z<bbi::Signed, S{} == bbi::Signed{}
+                                     ? max<size_t>(N, 2*sizeof(I)*CHAR_BIT)
+                                     : max<size_t>(2*N, sizeof(I)*CHAR_BIT)
+        , P>>;
+};
+
+template <bbi::SignTag S, unsigned N, bbi::Policy P, bbi::detail::StandardInteger I>
+struct common_type<I, bbi::Z<S, N, P>>
+{
+    using type = common_type_t<bbi::Z<S, N, P>, I>;
+};
+
+#if BBI_FLOAT_CONVERT
+template <bbi::SignTag S, unsigned N, bbi::Policy P, floating_point F>
+struct common_type<bbi::Z<S, N, P>, F>
+{
+    using type = F;
+};
+
+template <bbi::SignTag S, unsigned N, bbi::Policy P, floating_point F>
+struct common_type<F, bbi::Z<S, N, P>>
+{
+    using type = common_type_t<bbi::Z<S, N, P>, F>;
+};
+#endif  // BBI_FLOAT_CONVERT
+
+template <bbi::SignTag S, unsigned N, bbi::Policy P>
+class numeric_limits<bbi::Z<S, N, P>>
+{
+    using type = bbi::Z<S, N, P>;
+
+public:
+    static constexpr bool is_specialized = true;
+
+    static constexpr type min() noexcept
+    {
+        if constexpr (S{} == bbi::Signed{})
+        {
+            auto constexpr z = bbi::detail::set_high_bit(type{});
+            return z;
+        }
+        else
+        {
+            auto constexpr z = type{};
+            return z;
+        }
+    }
+
+    static constexpr type max() noexcept
+    {
+        if constexpr (S{} == bbi::Signed{})
+        {
+            auto constexpr z = bbi::detail::zero_high_bit(~type{});
+            return z;
+        }
+        else
+        {
+            auto constexpr z = ~type{};
+            return z;
+        }
+    }
+
+    static constexpr type lowest() noexcept {return min();}
+
+    static constexpr bool is_signed = S{} == bbi::Signed{};
+    static constexpr int  digits = static_cast<int>(N - is_signed);
+    static constexpr int  digits10 = static_cast<int>((N - is_signed)*76573ULL/254370);
+    static constexpr int  max_digits10 = 0;
+    static constexpr bool is_integer = true;
+    static constexpr bool is_exact = true;
+    static constexpr int  radix = 2;
+    static constexpr type epsilon() noexcept {return type{};}
+    static constexpr type round_error() noexcept {return type{};}
+
+    static constexpr int  min_exponent   = 0;
+    static constexpr int  min_exponent10 = 0;
+    static constexpr int  max_exponent   = 0;
+    static constexpr int  max_exponent10 = 0;
+
+    static constexpr bool has_infinity      = false;
+    static constexpr bool has_quiet_NaN     = false;
+    static constexpr bool has_signaling_NaN = false;
+    static constexpr bool has_denorm_loss   = false;
+    static constexpr type infinity()      noexcept {return type{};}
+    static constexpr type quiet_NaN()     noexcept {return type{};}
+    static constexpr type signaling_NaN() noexcept {return type{};}
+    static constexpr type denorm_min()    noexcept {return type{};}
+
+    static constexpr bool is_iec559 = false;
+    static constexpr bool is_bounded = true;
+    static constexpr bool is_modulo = is_same_v<P, bbi::Wrap>;
+
+    static constexpr bool traps           = false;
+    static constexpr bool tinyness_before = false;
+    static constexpr float_round_style round_style = round_toward_zero;
+};
+
+}  // namespace std
+
+namespace bbi
+{
+
+namespace detail
+{
+
+template <SignTag S, unsigned N, ErrorCheckedPolicy P, std::integral I>
+void
+conversion_overflowed(Z<S, N, P> const&, I const& y) noexcept (P{} != Throw{})
+{
+    using R = Z<S, N, P>;
+    auto const msg = to_string<R>() + '{' + to_string<I>() +
+                     '{' + std::to_string(y) + "}} overflowed";
+    if constexpr (P{} == Throw{})
+        throw std::overflow_error(msg);
+    else
+    {
+        std::cerr << msg << '\n';
+        std::terminate();
+    }
+}
+
+template <SignTag S, unsigned N, Policy P, std::integral I>
+inline
+constexpr
+void
+check(Z<S, N, P>& r, I i) noexcept (P{} != Throw{})
+{
+    if constexpr (P{} == Wrap{})
+        return;
+    if constexpr (P{} == Saturate{})
+    {
+        using R = Z<S, N, P>;
+        if constexpr ((S{} == Signed{}) == std::is_signed_v<I>)
+        {
+            // R and I have the same sign
+            if constexpr (std::numeric_limits<R>::digits >=
+                          std::numeric_limits<I>::digits)
+            {
+                return;  // I can not overflow R
+            }
+            else
+            {
+                // I can hold a superset of the values of R
+                auto constexpr Rm = std::numeric_limits<R>::min();
+                auto constexpr RM = std::numeric_limits<R>::max();
+                auto constexpr Im = I{Rm};
+                auto constexpr IM = I{RM};
+                if (i < Im)
+                    r = Rm;
+                else if (i > IM)
+                    r = RM;
+                return;
+            }
+        }
+        else
+        {
+            // R and I have different sign
+            if constexpr (S{} == Unsigned{})
+            {
+                // R is unsigned, I is signed
+                if (i < 0)
+                {
+                    auto constexpr zero = R{};
+                    r = zero;
+                    return;
+                }
+            }
+            if constexpr (std::numeric_limits<R>::digits >
+                          std::numeric_limits<I>::digits)
+            {
+                return;  // I can not overflow R
+            }
+            else
+            {
+                // I can hold a superset of the values of R but i is non-negative
+                auto constexpr RM = std::numeric_limits<R>::max();
+                auto constexpr IM = I{RM};
+                if (i > IM)
+                    r = RM;
+                return;
+            }
+        }
+    }
+    if constexpr (ErrorCheckedPolicy<P>)
+    {
+        using R = Z<S, N, P>;
+        if constexpr ((S{} == Signed{}) == std::is_signed_v<I>)
+        {
+            // R and I have the same sign
+            if constexpr (std::numeric_limits<R>::digits >=
+                          std::numeric_limits<I>::digits)
+            {
+                return;  // I can not overflow R
+            }
+            else
+            {
+                // I can hold a superset of the values of R
+                auto constexpr m = I{std::numeric_limits<R>::min()};
+                auto constexpr M = I{std::numeric_limits<R>::max()};
+                if (i < m || i > M)
+                    conversion_overflowed(R{}, i);
+                return;
+            }
+        }
+        else
+        {
+            // R and I have different sign
+            if constexpr (S{} == Unsigned{})
+            {
+                // R is unsigned, I is signed
+                if (i < 0)
+                    conversion_overflowed(R{}, i);
+            }
+            if constexpr (std::numeric_limits<R>::digits >
+                          std::numeric_limits<I>::digits)
+            {
+                return;  // I can not overflow R
+            }
+            else
+            {
+                // I can hold a superset of the values of R but i is non-negative
+                auto constexpr M = I{std::numeric_limits<R>::max()};
+                if (i > M)
+                    conversion_overflowed(R{}, i);
+                return;
+            }
+        }
+    }
+}
+
+#if BBI_FLOAT_CONVERT
+
+template <SignTag S, unsigned N, ErrorCheckedPolicy P, std::floating_point F>
+void
+conversion_overflowed(Z<S, N, P> const&, F const& y) noexcept (P{} != Throw{})
+{
+    using R = Z<S, N, P>;
+    auto const msg = to_string<R>() + '{' + to_string<F>() +
+                     '{' + std::to_string(y) + "}} overflowed";
+    if constexpr (P{} == Throw{})
+        throw std::overflow_error(msg);
+    else
+    {
+        std::cerr << msg << '\n';
+        std::terminate();
+    }
+}
+
+template <SignTag S, unsigned N, Policy P, std::floating_point F>
+constexpr
+void
+check(Z<S, N, P>& r, F f) noexcept (P{} != Throw{})
+{
+    if constexpr (P{} == Wrap{})
+        return;
+    if constexpr (P{} == Saturate{})
+    {
+        using R = Z<S, N, P>;
+        auto constexpr Rm = S{} == Signed{} ? std::numeric_limits<R>::min() : R{0};
+        auto constexpr RM = std::numeric_limits<R>::max();
+        auto constexpr Fm = F{Rm};
+        auto constexpr FM = F{RM};
+        if (f < Fm)
+            r = Rm;
+        else if (f > FM)
+            r = RM;
+        return;
+    }
+    if constexpr (ErrorCheckedPolicy<P>)
+    {
+        using R = Z<S, N, P>;
+        auto constexpr m = F{S{} == Signed{} ? std::numeric_limits<R>::min() : R{0}};
+        auto constexpr M = F{std::numeric_limits<R>::max()};
+        if (f < m || f > M)
+            conversion_overflowed(R{}, f);
+        return;
+    }
+}
+
+#endif  // BBI_FLOAT_CONVERT
+
+template <SignTag S1, unsigned N1, ErrorCheckedPolicy P1,
+          SignTag S2, unsigned N2, Policy P2>
+void
+conversion_overflowed(Z<S1, N1, P1> const&, Z<S2, N2, P2> const& y)
+    noexcept (P1{} != Throw{})
+{
+    using R = Z<S1, N1, P1>;
+    using Y = Z<S2, N2, P2>;
+    auto const msg = to_string<R>() + '{' + to_string<Y>() +
+                     '{' + to_string(y) + "}} overflowed";
+    if constexpr (P1{} == Throw{})
+        throw std::overflow_error(msg);
+     else
+    {
+        std::cerr << msg << '\n';
+        std::terminate();
+    }
+}
+
+template <SignTag S1, unsigned N1, Policy P1, SignTag S2, unsigned N2, Policy P2>
+inline
+constexpr
+void
+check(Z<S1, N1, P1>& r, Z<S2, N2, P2> const& x) noexcept (P1{} != Throw{})
+{
+    if constexpr (P1{} == Wrap{})
+        return;
+    else if constexpr (P1{} == Saturate{})
+    {
+        using RW = Z<S1, N1, Wrap>;
+        using XW = Z<S2, N2, Wrap>;
+        if constexpr (S1{} == S2{})
+        {
+            // R and X have the same sign
+            if constexpr (std::numeric_limits<RW>::digits >=
+                          std::numeric_limits<XW>::digits)
+            {
+                return;  // X can not overflow R
+            }
+            else
+            {
+                // X can hold a superset of the values of R
+                using R = Z<S1, N1, P1>;
+                auto constexpr Rm = std::numeric_limits<R>::min();
+                auto constexpr RM = std::numeric_limits<R>::max();
+                auto constexpr XWm = XW{Rm};
+                auto constexpr XWM = XW{RM};
+                XW xw{x};
+                if (xw < XWm)
+                    r = Rm;
+                else if (xw > XWM)
+                    r = RM;
+                return;
+            }
+        }
+        else
+        {
+            // R and X have different sign
+            if constexpr (S1{} == Unsigned{})
+            {
+                using X = Z<S2, N2, P2>;
+                auto constexpr Xzero = X{};
+                // R is unsigned, X is signed
+                if (x < Xzero)
+                {
+                    using R = Z<S1, N1, P1>;
+                    auto constexpr Rzero = R{};
+                    r = Rzero;
+                    return;
+                }
+            }
+            if constexpr (std::numeric_limits<RW>::digits >
+                          std::numeric_limits<XW>::digits)
+            {
+                return;  // X can not overflow R
+            }
+            else
+            {
+                // X can hold a superset of the values of R but x is non-negative
+                using R = Z<S1, N1, P1>;
+                auto constexpr RM = std::numeric_limits<R>::max();
+                auto constexpr XWM = XW{RM};
+                XW xw{x};
+                if (xw > XWM)
+                    r = RM;
+                return;
+            }
+        }
+    }
+    else if constexpr (ErrorCheckedPolicy<P1>)
+    {
+        using R = Z<S1, N1, P1>;
+        using RW = Z<S1, N1, Wrap>;
+        using XW = Z<S2, N2, Wrap>;
+        auto constexpr m = XW{std::numeric_limits<RW>::min()};
+        auto constexpr M = XW{std::numeric_limits<RW>::max()};
+        if constexpr (S1{} == S2{})
+        {
+            // R and X have the same sign
+            if constexpr (std::numeric_limits<RW>::digits >=
+                          std::numeric_limits<XW>::digits)
+            {
+                return;  // X can not overflow R
+            }
+            else
+            {
+                // X can hold a superset of the values of R
+                using R = Z<S1, N1, P1>;
+                XW xw{x};
+                if (xw < m || xw > M)
+                    conversion_overflowed(R{}, x);
+                return;
+            }
+        }
+        else
+        {
+            // R and X have different sign
+            if constexpr (S1{} == Unsigned{})
+            {
+                // R is unsigned, X is signed
+                if (x.is_neg())
+                    conversion_overflowed(R{}, x);
+            }
+            if constexpr (std::numeric_limits<RW>::digits >
+                          std::numeric_limits<XW>::digits)
+            {
+                return;  // X can not overflow R
+            }
+            else
+            {
+                // X can hold a superset of the values of R but x is non-negative
+                XW xw{x};
+                if (xw > M)
+                    conversion_overflowed(R{}, x);
+               return;
+            }
+        }
+    }
+}
+
+}  // namespace detail
+
+template <SignTag S, unsigned N, Policy P>
+inline
+constexpr
+bool
+operator==(Z<S, N, P> const& x, Z<S, N, P> const& y) noexcept
+{
+    if constexpr (N <= Nlimit)
+        return x.rep_ == y.rep_;
+    else
+        return x.limbs_ == y.limbs_;
+}
+
+template <SignTag S1, unsigned N1, Policy P, SignTag S2, unsigned N2>
+inline
+constexpr
+bool
+operator==(Z<S1, N1, P> const& x, Z<S2, N2, P> const& y) noexcept
+{
+    using R = std::common_type_t<decltype(x), decltype(y)>;
+    return R{x} == R{y};
+}
 
-    static constexpr bool has_infinity      = false;
-    static constexpr bool has_quiet_NaN     = false;
-    static constexpr bool has_signaling_NaN = false;
-    static constexpr bool has_denorm_loss   = false;
-    static constexpr type infinity()      noexcept {return type{};}
-    static constexpr type quiet_NaN()     noexcept {return type{};}
-    static constexpr type signaling_NaN() noexcept {return type{};}
-    static constexpr type denorm_min()    noexcept {return type{};}
+template <SignTag S, unsigned N, Policy P, detail::StandardInteger I>
+constexpr
+inline
+bool
+operator==(Z<S, N, P> const& x, I const& y) noexcept
+{
+    using R = std::common_type_t<decltype(x), decltype(y)>;
+    return R{x} == R{y};
+}
+
+template <SignTag S, unsigned N, Policy P, detail::StandardInteger I>
+constexpr
+inline
+bool
+operator==(I const& x,  Z<S, N, P> const&y) noexcept
+{
+    using R = std::common_type_t<decltype(x), decltype(y)>;
+    return R{x} == R{y};
+}
+
+#if BBI_FLOAT_CONVERT
+
+template <SignTag S, unsigned N, Policy P, std::floating_point F>
+constexpr
+inline
+bool
+operator==(Z<S, N, P> const& x, F const& y) noexcept
+{
+    using R = std::common_type_t<decltype(x), decltype(y)>;
+    return R{x} == R{y};
+}
+
+template <SignTag S, unsigned N, Policy P, std::floating_point F>
+constexpr
+inline
+bool
+operator==(F const& x, Z<S, N, P> const& y) noexcept
+{
+    using R = std::common_type_t<decltype(x), decltype(y)>;
+    return R{x} == R{y};
+}
+
+#endif  // BBI_FLOAT_CONVERT
+
+template <SignTag S1, unsigned N1, Policy P, SignTag S2, unsigned N2>
+inline
+constexpr
+bool
+operator!=(Z<S1, N1, P> const& x, Z<S2, N2, P> const& y) noexcept
+{
+    return !(x == y);
+}
+
+template <SignTag S, unsigned N, Policy P, detail::StandardInteger I>
+constexpr
+inline
+bool
+operator!=(Z<S, N, P> const& x, I const& y) noexcept
+{
+    using R = std::common_type_t<decltype(x), decltype(y)>;
+    return R{x} != R{y};
+}
+
+template <SignTag S, unsigned N, Policy P, detail::StandardInteger I>
+constexpr
+inline
+bool
+operator!=(I const& x,  Z<S, N, P> const&y) noexcept
+{
+    using R = std::common_type_t<decltype(x), decltype(y)>;
+    return R{x} != R{y};
+}
+
+#if BBI_FLOAT_CONVERT
+
+template <SignTag S, unsigned N, Policy P, std::floating_point I>
+constexpr
+inline
+bool
+operator!=(Z<S, N, P> const& x, I const& y) noexcept
+{
+    using R = std::common_type_t<decltype(x), decltype(y)>;
+    return R{x} != R{y};
+}
+
+template <SignTag S, unsigned N, Policy P, std::floating_point I>
+constexpr
+inline
+bool
+operator!=(I const& x,  Z<S, N, P> const&y) noexcept
+{
+    using R = std::common_type_t<decltype(x), decltype(y)>;
+    return R{x} != R{y};
+}
+
+#endif  // BBI_FLOAT_CONVERT
+
+template <SignTag S, unsigned N, Policy P>
+inline
+constexpr
+bool
+operator<(Z<S, N, P> const& x, Z<S, N, P> const& y) noexcept
+{
+    if constexpr (N <= Nlimit)
+    {
+        if constexpr (S{} == Signed{})
+        {
+            using rep = typename Z<Signed, N, P>::rep;
+            return rep(x.rep_) < rep(y.rep_);
+        }
+        else
+        {
+            return x.rep_ < y.rep_;
+        }
+    }
+    else
+    {
+        // The most significant limb of a signed value compares as signed
+        auto constexpr n = Z<S, N, P>::nlimbs;
+        if (x.limbs_[n-1] != y.limbs_[n-1])
+        {
+            if constexpr (S{} == Signed{})
+            {
+                using slimb_t = std::make_signed_t<detail::limb_t>;
+                return slimb_t(x.limbs_[n-1]) < slimb_t(y.limbs_[n-1]);
+            }
+            else
+            {
+                return x.limbs_[n-1] < y.limbs_[n-1];
+            }
+        }
+        for (auto j = n-1; j-- > 0;)
+        {
+            if (x.limbs_[j] != y.limbs_[j])
+                return x.limbs_[j] < y.limbs_[j];
+        }
+        return false;
+    }
+}
+
+template <SignTag S1, unsigned N1, Policy P, SignTag S2, unsigned N2>
+inline
+constexpr
+bool
+operator<(Z<S1, N1, P> const& x, Z<S2, N2, P> const& y) noexcept
+{
+    using R = std::common_type_t<decltype(x), decltype(y)>;
+    return R{x} < R{y};
+}
+
+template <SignTag S, unsigned N, Policy P, detail::StandardInteger I>
+constexpr
+inline
+bool
+operator<(Z<S, N, P> const& x, I const& y) noexcept
+{
+    using R = std::common_type_t<decltype(x), decltype(y)>;
+    return R{x} < R{y};
+}
+
+template <SignTag S, unsigned N, Policy P, detail::StandardInteger I>
+constexpr
+inline
+bool
+operator<(I const& x, Z<S, N, P> const& y) noexcept
+{
+    using R = std::common_type_t<decltype(x), decltype(y)>;
+    return R{x} < R{y};
+}
+
+#if BBI_FLOAT_CONVERT
+
+template <SignTag S, unsigned N, Policy P, std::floating_point I>
+constexpr
+inline
+bool
+operator<(Z<S, N, P> const& x, I const& y) noexcept
+{
+    using R = std::common_type_t<decltype(x), decltype(y)>;
+    return R{x} < R{y};
+}
+
+template <SignTag S, unsigned N, Policy P, std::floating_point I>
+constexpr
+inline
+bool
+operator<(I const& x, Z<S, N, P> const& y) noexcept
+{
+    using R = std::common_type_t<decltype(x), decltype(y)>;
+    return R{x} < R{y};
+}
+
+#endif  // BBI_FLOAT_CONVERT
+
+template <SignTag S1, unsigned N1, Policy P, SignTag S2, unsigned N2>
+inline
+constexpr
+bool
+operator>(Z<S1, N1, P> const& x, Z<S2, N2, P> const& y) noexcept
+{
+    return y < x;
+}
+
+template <SignTag S, unsigned N, Policy P, detail::StandardInteger I>
+constexpr
+inline
+bool
+operator>(Z<S, N, P> const& x, I const& y) noexcept
+{
+    return y < x;
+}
+
+template <SignTag S, unsigned N, Policy P, detail::StandardInteger I>
+constexpr
+inline
+bool
+operator>(I const& x, Z<S, N, P> const& y) noexcept
+{
+    return y < x;
+}
+
+#if BBI_FLOAT_CONVERT
+
+template <SignTag S, unsigned N, Policy P, std::floating_point I>
+constexpr
+inline
+bool
+operator>(Z<S, N, P> const& x, I const& y) noexcept
+{
+    return y < x;
+}
+
+template <SignTag S, unsigned N, Policy P, std::floating_point I>
+constexpr
+inline
+bool
+operator>(I const& x, Z<S, N, P> const& y) noexcept
+{
+    return y < x;
+}
+
+#endif  // BBI_FLOAT_CONVERT
+
+template <SignTag S1, unsigned N1, Policy P, SignTag S2, unsigned N2>
+inline
+constexpr
+bool
+operator<=(Z<S1, N1, P> const& x, Z<S2, N2, P> const& y) noexcept
+{
+    return !(y < x);
+}
+
+template <SignTag S, unsigned N, Policy P, detail::StandardInteger I>
+inline
+constexpr
+bool
+operator<=(Z<S, N, P> const& x, I const& y) noexcept
+{
+    return !(y < x);
+}
 
-    static constexpr bool is_iec559 = false;
-    static constexpr bool is_bounded = true;
-    static constexpr bool is_modulo = is_same_v<P, bbi::Wrap>;
+template <SignTag S, unsigned N, Policy P, detail::StandardInteger I>
+inline
+constexpr
+bool
+operator<=( I const& x, Z<S, N, P> const& y) noexcept
+{
+    return !(y < x);
+}
 
-    static constexpr bool traps           = false;
-    static constexpr bool tinyness_before = false;
-    static constexpr float_round_style round_style = round_toward_zero;
-};
+#if BBI_FLOAT_CONVERT
 
-}  // namespace std
+template <SignTag S, unsigned N, Policy P, std::floating_point I>
+inline
+constexpr
+bool
+operator<=(Z<S, N, P> const& x, I const& y) noexcept
+{
+    return !(y < x);
+}
 
-namespace bbi
+template <SignTag S, unsigned N, Policy P, std::floating_point I>
+inline
+constexpr
+bool
+operator<=( I const& x, Z<S, N, P> const& y) noexcept
 {
+    return !(y < x);
+}
 
-namespace detail
+#endif  // BBI_FLOAT_CONVERT
+
+template <SignTag S1, unsigned N1, Policy P, SignTag S2, unsigned N2>
+inline
+constexpr
+bool
+operator>=(Z<S1, N1, P> const& x, Z<S2, N2, P> const& y) noexcept
 {
+    return !(x < y);
+}
 
-template <SignTag S, unsigned N, ErrorCheckedPolicy P, std::integral I>
-void
-conversion_overflowed(Z<S, N, P> const&, I const& y) noexcept (P{} != Throw{})
+template <SignTag S, unsigned N, Policy P, detail::StandardInteger I>
+inline
+constexpr
+bool
+operator>=(Z<S, N, P> const& x, I const& y) noexcept
 {
-    using R = Z<S, N, P>;
-    auto const msg = to_string<R>() + '{' + to_string<I>() +
-                     '{' + std::to_string(y) + "}} overflowed";
-    if constexpr (P{} == Throw{})
-        throw std::overflow_error(msg);
-    else
-    {
-        std::cerr << msg << '\n';
-        std::terminate();
-    }
+    return !(x < y);
 }
 
-template <SignTag S, unsigned N, Policy P, std::integral I>
+template <SignTag S, unsigned N, Policy P, detail::StandardInteger I>
 inline
 constexpr
-void
-check(Z<S, N, P>& r, I i) noexcept (P{} != Throw{})
+bool
+operator>=(I const& x, Z<S, N, P> const& y) noexcept
 {
-    if constexpr (P{} == Wrap{})
-        return;
-    if constexpr (P{} == Saturate{})
-    {
-        using R = Z<S, N, P>;
-        if constexpr ((S{} == Signed{}) == std::is_signed_v<I>)
-        {
-            // R and I have the same sign
-            if constexpr (std::numeric_limits<R>::digits >=
-                          std::numeric_limits<I>::digits)
-            {
-                return;  // I can not overflow R
-            }
-            else
-            {
-                // I can hold a superset of the values of R
-                auto constexpr Rm = std::numeric_limits<R>::min();
-                auto constexpr RM = std::numeric_limits<R>::max();
-                auto constexpr Im = I{Rm};
-                auto constexpr IM = I{RM};
-                if (i < Im)
-                    r = Rm;
-                else if (i > IM)
-                    r = RM;
-                return;
-            }
-        }
-        else
-        {
-            // R and I have different sign
-            if constexpr (S{} == Unsigned{})
-            {
-                // R is unsigned, I is signed
-                if (i < 0)
-                {
-                    auto constexpr zero = R{};
-                    r = zero;
-                    return;
-                }
-            }
-            if constexpr (std::numeric_limits<R>::digits >
-                          std::numeric_limits<I>::digits)
-            {
-                return;  // I can not overflow R
-            }
-            else
-            {
-                // I can hold a superset of the values of R but i is non-negative
-                auto constexpr RM = std::numeric_limits<R>::max();
-                auto constexpr IM = I{RM};
-                if (i > IM)
-                    r = RM;
-                return;
-            }
-        }
-    }
-    if constexpr (ErrorCheckedPolicy<P>)
-    {
-        using R = Z<S, N, P>;
-        if constexpr ((S{} == Signed{}) == std::is_signed_v<I>)
-        {
-            // R and I have the same sign
-            if constexpr (std::numeric_limits<R>::digits >=
-                          std::numeric_limits<I>::digits)
-            {
-                return;  // I can not overflow R
-            }
-            else
-            {
-                // I can hold a superset of the values of R
-                auto constexpr m = I{std::numeric_limits<R>::min()};
-                auto constexpr M = I{std::numeric_limits<R>::max()};
-                if (i < m || i > M)
-                    conversion_overflowed(R{}, i);
-                return;
-            }
-        }
-        else
-        {
-            // R and I have different sign
-            if constexpr (S{} == Unsigned{})
-            {
-                // R is unsigned, I is signed
-                if (i < 0)
-                    conversion_overflowed(R{}, i);
-            }
-            if constexpr (std::numeric_limits<R>::digits >
-                          std::numeric_limits<I>::digits)
-            {
-                return;  // I can not overflow R
-            }
-            else
-            {
-                // I can hold a superset of the values of R but i is non-negative
-                auto constexpr M = I{std::numeric_limits<R>::max()};
-                if (i > M)
-                    conversion_overflowed(R{}, i);
-                return;
-            }
-        }
-    }
+    return !(x < y);
 }
 
 #if BBI_FLOAT_CONVERT
 
-template <SignTag S, unsigned N, ErrorCheckedPolicy P, std::floating_point F>
-void
-conversion_overflowed(Z<S, N, P> const&, F const& y) noexcept (P{} != Throw{})
+template <SignTag S, unsigned N, Policy P, std::floating_point I>
+inline
+constexpr
+bool
+operator>=(Z<S, N, P> const& x, I const& y) noexcept
 {
-    using R = Z<S, N, P>;
-    auto const msg = to_string<R>() + '{' + to_string<F>() +
-                     '{' + std::to_string(y) + "}} overflowed";
-    if constexpr (P{} == Throw{})
-        throw std::overflow_error(msg);
-    else
-    {
-        std::cerr << msg << '\n';
-        std::terminate();
-    }
+    return !(x < y);
 }
 
-template <SignTag S, unsigned N, Policy P, std::floating_point F>
+template <SignTag S, unsigned N, Policy P, std::floating_point I>
+inline
 constexpr
-void
-check(Z<S, N, P>& r, F f) noexcept (P{} != Throw{})
+bool
+operator>=(I const& x, Z<S, N, P> const& y) noexcept
 {
-    if constexpr (P{} == Wrap{})
-        return;
-    if constexpr (P{} == Saturate{})
-    {
-        using R = Z<S, N, P>;
-        auto constexpr Rm = S{} == Signed{} ? std::numeric_limits<R>::min() : R{0};
-        auto constexpr RM = std::numeric_limits<R>::max();
-        auto constexpr Fm = F{Rm};
-        auto constexpr FM = F{RM};
-        if (f < Fm)
-            r = Rm;
-        else if (f > FM)
-            r = RM;
-        return;
-    }
-    if constexpr (ErrorCheckedPolicy<P>)
-    {
-        using R = Z<S, N, P>;
-        auto constexpr m = F{S{} == Signed{} ? std::numeric_limits<R>::min() : R{0}};
-        auto constexpr M = F{std::numeric_limits<R>::max()};
-        if (f < m || f > M)
-            conversion_overflowed(R{}, f);
-        return;
+    return !(x < y);
+}
+
+#endif  // BBI_FLOAT_CONVERT
+
+template <SignTag S, unsigned N>
+inline
+constexpr
+Z<S, N, Wrap>
+operator<<(Z<S, N, Wrap> const& x, int n) noexcept
+{
+    constexpr unsigned mask = N-1;
+    n &= mask;
+    return x.left_shift(n);
+}
+
+template <SignTag S, unsigned N>
+inline
+constexpr
+Z<S, N, Wrap>
+operator>>(Z<S, N, Wrap> const& x, int n) noexcept
+{
+    constexpr unsigned mask = N-1;
+    n &= mask;
+    if constexpr (S{} == Signed{})
+        return x.right_shift_signed(n);
+    else
+        return x.right_shift_unsigned(n);
+}
+
+template <SignTag S, unsigned N>
+inline
+constexpr
+Z<S, N, Saturate>
+operator<<(Z<S, N, Saturate> const& x, int n) noexcept
+{
+    using X = Z<S, N, Saturate>;
+    if (n < 0)
+    {
+        if (n == std::numeric_limits<int>::min())
+            ++n;
+        return x >> -n;
     }
+    if (static_cast<unsigned>(n) >= N)
+        return X{};
+    return x.left_shift(unsigned(n));
 }
 
-#endif  // BBI_FLOAT_CONVERT
-
-template <SignTag S1, unsigned N1, ErrorCheckedPolicy P1,
-          SignTag S2, unsigned N2, Policy P2>
-void
-conversion_overflowed(Z<S1, N1, P1> const&, Z<S2, N2, P2> const& y)
-    noexcept (P1{} != Throw{})
+template <SignTag S, unsigned N>
+inline
+constexpr
+Z<S, N, Saturate>
+operator>>(Z<S, N, Saturate> const& x, int n) noexcept
 {
-    using R = Z<S1, N1, P1>;
-    using Y = Z<S2, N2, P2>;
-    auto const msg = to_string<R>() + '{' + to_string<Y>() +
-                     '{' + to_string(y) + "}} overflowed";
-    if constexpr (P1{} == Throw{})
-        throw std::overflow_error(msg);
-     else
+    using X = Z<S, N, Saturate>;
+    if (n < 0)
     {
-        std::cerr << msg << '\n';
-        std::terminate();
+        if (n == std::numeric_limits<int>::min())
+            ++n;
+        return x << -n;
+    }
+    if (static_cast<unsigned>(n) >= N)
+    {
+        if (x.is_neg())
+        {
+            auto constexpr ones = ~X{};
+            return ones;
+        }
+        auto constexpr zeroes = X{};
+        return zeroes;
     }
+    if constexpr (S{} == Signed{})
+        return x.right_shift_signed(unsigned(n));
+    else
+        return x.right_shift_unsigned(unsigned(n));
 }
 
-template <SignTag S1, unsigned N1, Policy P1, SignTag S2, unsigned N2, Policy P2>
+template <SignTag S, unsigned N, ErrorCheckedPolicy P>
 inline
 constexpr
-void
-check(Z<S1, N1, P1>& r, Z<S2, N2, P2> const& x) noexcept (P1{} != Throw{})
+Z<S, N, P>
+operator<<(Z<S, N, P> const& x, int n) noexcept(P{} == Terminate{})
 {
-    if constexpr (P1{} == Wrap{})
-        return;
-    else if constexpr (P1{} == Saturate{})
+    using X = Z<S, N, P>;
+    if (n < 0 || static_cast<unsigned>(n) >= N)
     {
-        using RW = Z<S1, N1, Wrap>;
-        using XW = Z<S2, N2, Wrap>;
-        if constexpr (S1{} == S2{})
-        {
-            // R and X have the same sign
-            if constexpr (std::numeric_limits<RW>::digits >=
-                          std::numeric_limits<XW>::digits)
-            {
-                return;  // X can not overflow R
-            }
-            else
-            {
-                // X can hold a superset of the values of R
-                using R = Z<S1, N1, P1>;
-                auto constexpr Rm = std::numeric_limits<R>::min();
-                auto constexpr RM = std::numeric_limits<R>::max();
-                auto constexpr XWm = XW{Rm};
-                auto constexpr XWM = XW{RM};
-                XW xw{x};
-                if (xw < XWm)
-                    r = Rm;
-                else if (xw > XWM)
-                    r = RM;
-                return;
-            }
-        }
+        auto const msg = to_string<X>() + '{' + to_string(x) + "} << " +
+                         std::to_string(n) + " overflowed";
+        if constexpr (P{} == Throw{})
+            throw std::overflow_error(msg);
         else
         {
-            // R and X have different sign
-            if constexpr (S1{} == Unsigned{})
-            {
-                using X = Z<S2, N2, P2>;
-                auto constexpr Xzero = X{};
-                // R is unsigned, X is signed
-                if (x < Xzero)
-                {
-                    using R = Z<S1, N1, P1>;
-                    auto constexpr Rzero = R{};
-                    r = Rzero;
-                    return;
-                }
-            }
-            if constexpr (std::numeric_limits<RW>::digits >
-                          std::numeric_limits<XW>::digits)
-            {
-                return;  // X can not overflow R
-            }
-            else
-            {
-                // X can hold a superset of the values of R but x is non-negative
-                using R = Z<S1, N1, P1>;
-                auto constexpr RM = std::numeric_limits<R>::max();
-                auto constexpr XWM = XW{RM};
-                XW xw{x};
-                if (xw > XWM)
-                    r = RM;
-                return;
-            }
+            std::cerr << msg << '\n';
+            std::terminate();
         }
     }
-    else if constexpr (ErrorCheckedPolicy<P1>)
+    return x.left_shift(unsigned(n));
+}
+
+template <SignTag S, unsigned N, ErrorCheckedPolicy P>
+inline
+constexpr
+Z<S, N, P>
+operator>>(Z<S, N, P> const& x, int n) noexcept(P{} == Terminate{})
+{
+    using X = Z<S, N, P>;
+    if (n < 0 || static_cast<unsigned>(n) >= N)
     {
-        using R = Z<S1, N1, P1>;
-        using RW = Z<S1, N1, Wrap>;
-        using XW = Z<S2, N2, Wrap>;
-        auto constexpr m = XW{std::numeric_limits<RW>::min()};
-        auto constexpr M = XW{std::numeric_limits<RW>::max()};
-        if constexpr (S1{} == S2{})
-        {
-            // R and X have the same sign
-            if constexpr (std::numeric_limits<RW>::digits >=
-                          std::numeric_limits<XW>::digits)
-            {
-                return;  // X can not overflow R
-            }
-            else
-            {
-                // X can hold a superset of the values of R
-                using R = Z<S1, N1, P1>;
-                XW xw{x};
-                if (xw < m || xw > M)
-                    conversion_overflowed(R{}, x);
-                return;
-            }
-        }
+        auto const msg = to_string<X>() + '{' + to_string(x) + "} >> " +
+                         std::to_string(n) + " overflowed";
+        if constexpr (P{} == Throw{})
+            throw std::overflow_error(msg);
         else
         {
-            // R and X have different sign
-            if constexpr (S1{} == Unsigned{})
-            {
-                // R is unsigned, X is signed
-                if (x.is_neg())
-                    conversion_overflowed(R{}, x);
-            }
-            if constexpr (std::numeric_limits<RW>::digits >
-                          std::numeric_limits<XW>::digits)
-            {
-                return;  // X can not overflow R
-            }
-            else
-            {
-                // X can hold a superset of the values of R but x is non-negative
-                XW xw{x};
-                if (xw > M)
-                    conversion_overflowed(R{}, x);
-               return;
-            }
+            std::cerr << msg << '\n';
+            std::terminate();
         }
     }
+    if constexpr (S{} == Signed{})
+        return x.right_shift_signed(unsigned(n));
+    else
+        return x.right_shift_unsigned(unsigned(n));
 }
 
-}  // namespace detail
-
 template <SignTag S, unsigned N, Policy P>
 inline
 constexpr
-bool
-operator==(Z<S, N, P> const& x, Z<S, N, P> const& y) noexcept
+Z<S, N, P>
+operator<<(Z<S, N, P> const& x, Z<S, N, P> const& y) noexcept
 {
-    if constexpr (N <= Nlimit)
-        return x.rep_ == y.rep_;
-    else
-        return x.hi_ == y.hi_ && x.lo_ == y.lo_;
+    return x << static_cast<int>(y);
 }
 
-template <SignTag S1, unsigned N1, Policy P, SignTag S2, unsigned N2>
+template <SignTag S, unsigned N, Policy P>
 inline
 constexpr
-bool
-operator==(Z<S1, N1, P> const& x, Z<S2, N2, P> const& y) noexcept
+Z<S, N, P>
+operator>>(Z<S, N, P> const& x, Z<S, N, P> const& y) noexcept
 {
-    using R = std::common_type_t<decltype(x), decltype(y)>;
-    return R{x} == R{y};
+    return x >> static_cast<int>(y);
 }
 
-template <SignTag S, unsigned N, Policy P, detail::StandardInteger I>
+template <SignTag S, unsigned N, Policy P>
+inline
 constexpr
+Z<S, N, P>
+operator~(Z<S, N, P> const& x) noexcept
+{
+    Z<S, N, P> r;
+    if constexpr (N <= Nlimit)
+    {
+        using urep_t = typename Z<S, N, P>::urep_t;
+        r.rep_ = urep_t(~x.rep_);
+    }
+    else
+    {
+        for (unsigned j = 0; j < r.nlimbs; ++j)
+            r.limbs_[j] = detail::limb_t(~x.limbs_[j]);
+    }
+    return r;
+}
+
+template <SignTag S, unsigned N, Policy P>
 inline
-bool
-operator==(Z<S, N, P> const& x, I const& y) noexcept
+constexpr
+Z<S, N, P>
+operator&(Z<S, N, P> const& x, Z<S, N, P> const& y) noexcept
 {
-    using R = std::common_type_t<decltype(x), decltype(y)>;
-    return R{x} == R{y};
+    Z<S, N, P> r;
+    if constexpr (N <= Nlimit)
+    {
+        using urep_t = typename Z<S, N, P>::urep_t;
+        r.rep_ = urep_t(x.rep_ & y.rep_);
+    }
+    else
+    {
+        for (unsigned j = 0; j < r.nlimbs; ++j)
+            r.limbs_[j] = x.limbs_[j] & y.limbs_[j];
+    }
+    return r;
 }
 
-template <SignTag S, unsigned N, Policy P, detail::StandardInteger I>
+template <SignTag S1, unsigned N1, Policy P, SignTag S2, unsigned N2>
 constexpr
 inline
-bool
-operator==(I const& x,  Z<S, N, P> const&y) noexcept
+auto
+operator&(Z<S1, N1, P> const& x, Z<S2, N2, P> const& y) noexcept(P{} != Throw{})
+    -> std::common_type_t<decltype(x), decltype(y)>
 {
-    using R = std::common_type_t<decltype(x), decltype(y)>;
-    return R{x} == R{y};
+    using X = decltype(x);
+    using Y = decltype(y);
+    using R = std::common_type_t<X, Y>;
+    return R{x} & R{y};
 }
 
-#if BBI_FLOAT_CONVERT
-
-template <SignTag S, unsigned N, Policy P, std::floating_point F>
+template <SignTag S, unsigned N, Policy P, detail::StandardInteger I>
 constexpr
 inline
-bool
-operator==(Z<S, N, P> const& x, F const& y) noexcept
+auto
+operator&(Z<S, N, P> const& x, I const& i) noexcept(P{} != Throw{})
+    -> std::common_type_t<decltype(x), decltype(i)>
 {
-    using R = std::common_type_t<decltype(x), decltype(y)>;
-    return R{x} == R{y};
+    using X = decltype(x);
+    using R = std::common_type_t<X, I>;
+    return R{x} & R{i};
 }
 
-template <SignTag S, unsigned N, Policy P, std::floating_point F>
+template <SignTag S, unsigned N, Policy P, detail::StandardInteger I>
 constexpr
 inline
-bool
-operator==(F const& x, Z<S, N, P> const& y) noexcept
+auto
+operator&(I const& i, Z<S, N, P> const& y) noexcept(P{} != Throw{})
+    -> std::common_type_t<decltype(i), decltype(y)>
 {
-    using R = std::common_type_t<decltype(x), decltype(y)>;
-    return R{x} == R{y};
+    return y & i;
 }
 
-#endif  // BBI_FLOAT_CONVERT
-
-template <SignTag S1, unsigned N1, Policy P, SignTag S2, unsigned N2>
+template <SignTag S, unsigned N, Policy P>
 inline
 constexpr
-bool
-operator!=(Z<S1, N1, P> const& x, Z<S2, N2, P> const& y) noexcept
+Z<S, N, P>
+operator^(Z<S, N, P> const& x, Z<S, N, P> const& y) noexcept
 {
-    return !(x == y);
+    Z<S, N, P> r;
+    if constexpr (N <= Nlimit)
+    {
+        using urep_t = typename Z<S, N, P>::urep_t;
+        r.rep_ = urep_t(x.rep_ ^ y.rep_);
+    }
+    else
+    {
+        for (unsigned j = 0; j < r.nlimbs; ++j)
+            r.limbs_[j] = x.limbs_[j] ^ y.limbs_[j];
+    }
+    return r;
 }
 
-template <SignTag S, unsigned N, Policy P, detail::StandardInteger I>
+template <SignTag S1, unsigned N1, Policy P, SignTag S2, unsigned N2>
 constexpr
 inline
-bool
-operator!=(Z<S, N, P> const& x, I const& y) noexcept
+auto
+operator^(Z<S1, N1, P> const& x, Z<S2, N2, P> const& y) noexcept(P{} != Throw{})
+    -> std::common_type_t<decltype(x), decltype(y)>
 {
-    using R = std::common_type_t<decltype(x), decltype(y)>;
-    return R{x} != R{y};
+    using X = decltype(x);
+    using Y = decltype(y);
+    using R = std::common_type_t<X, Y>;
+    return R{x} ^ R{y};
 }
 
 template <SignTag S, unsigned N, Policy P, detail::StandardInteger I>
 constexpr
 inline
-bool
-operator!=(I const& x,  Z<S, N, P> const&y) noexcept
-{
-    using R = std::common_type_t<decltype(x), decltype(y)>;
-    return R{x} != R{y};
-}
-
-#if BBI_FLOAT_CONVERT
-
-template <SignTag S, unsigned N, Policy P, std::floating_point I>
-constexpr
-inline
-bool
-operator!=(Z<S, N, P> const& x, I const& y) noexcept
+auto
+operator^(Z<S, N, P> const& x, I const& i) noexcept(P{} != Throw{})
+    -> std::common_type_t<decltype(x), decltype(i)>
 {
-    using R = std::common_type_t<decltype(x), decltype(y)>;
-    return R{x} != R{y};
+    using X = decltype(x);
+    using R = std::common_type_t<X, I>;
+    return R{x} ^ R{i};
 }
 
-template <SignTag S, unsigned N, Policy P, std::floating_point I>
+template <SignTag S, unsigned N, Policy P, detail::StandardInteger I>
 constexpr
 inline
-bool
-operator!=(I const& x,  Z<S, N, P> const&y) noexcept
+auto
+operator^(I const& i, Z<S, N, P> const& y) noexcept(P{} != Throw{})
+    -> std::common_type_t<decltype(i), decltype(y)>
 {
-    using R = std::common_type_t<decltype(x), decltype(y)>;
-    return R{x} != R{y};
+    return y ^ i;
 }
 
-#endif  // BBI_FLOAT_CONVERT
-
 template <SignTag S, unsigned N, Policy P>
 inline
 constexpr
-bool
-operator<(Z<S, N, P> const& x, Z<S, N, P> const& y) noexcept
+Z<S, N, P>
+operator|(Z<S, N, P> const& x, Z<S, N, P> const& y) noexcept
 {
+    Z<S, N, P> r;
     if constexpr (N <= Nlimit)
     {
-        if constexpr (S{} == Signed{})
-        {
-            using rep = typename Z<Signed, N, P>::rep;
-            return rep(x.rep_) < rep(y.rep_);
-        }
-        else
-        {
-            return x.rep_ < y.rep_;
-        }
+        using urep_t = typename Z<S, N, P>::urep_t;
+        r.rep_ = urep_t(x.rep_ | y.rep_);
     }
     else
     {
-        if constexpr (S{} == Signed{})
-        {
-            using shalf_t = typename Z<Signed, N, P>::shalf_t;
-            return shalf_t(x.hi_) < shalf_t(y.hi_) ?
-                       true :
-                       x.hi_ == y.hi_ ?
-                           x.lo_ < y.lo_ :
-                           false;
-        }
-        else
-        {
-            return x.hi_ < y.hi_ ?
-                       true :
-                       x.hi_ == y.hi_ ?
-                           x.lo_ < y.lo_ :
-                           false;
-        }
+        for (unsigned j = 0; j < r.nlimbs; ++j)
+            r.limbs_[j] = x.limbs_[j] | y.limbs_[j];
     }
+    return r;
 }
 
 template <SignTag S1, unsigned N1, Policy P, SignTag S2, unsigned N2>
-inline
 constexpr
-bool
-operator<(Z<S1, N1, P> const& x, Z<S2, N2, P> const& y) noexcept
+inline
+auto
+operator|(Z<S1, N1, P> const& x, Z<S2, N2, P> const& y) noexcept(P{} != Throw{})
+    -> std::common_type_t<decltype(x), decltype(y)>
 {
-    using R = std::common_type_t<decltype(x), decltype(y)>;
-    return R{x} < R{y};
+    using X = decltype(x);
+    using Y = decltype(y);
+    using R = std::common_type_t<X, Y>;
+    return R{x} | R{y};
 }
 
 template <SignTag S, unsigned N, Policy P, detail::StandardInteger I>
 constexpr
 inline
-bool
-operator<(Z<S, N, P> const& x, I const& y) noexcept
+auto
+operator|(Z<S, N, P> const& x, I const& i) noexcept(P{} != Throw{})
+    -> std::common_type_t<decltype(x), decltype(i)>
 {
-    using R = std::common_type_t<decltype(x), decltype(y)>;
-    return R{x} < R{y};
+    using X = decltype(x);
+    using R = std::common_type_t<X, I>;
+    return R{x} | R{i};
 }
 
 template <SignTag S, unsigned N, Policy P, detail::StandardInteger I>
 constexpr
 inline
-bool
-operator<(I const& x, Z<S, N, P> const& y) noexcept
+auto
+operator|(I const& i, Z<S, N, P> const& y) noexcept(P{} != Throw{})
+    -> std::common_type_t<decltype(i), decltype(y)>
 {
-    using R = std::common_type_t<decltype(x), decltype(y)>;
-    return R{x} < R{y};
+    return y | i;
 }
 
-#if BBI_FLOAT_CONVERT
+// + Wrap
 
-template <SignTag S, unsigned N, Policy P, std::floating_point I>
+template <SignTag S, unsigned N>
 constexpr
 inline
-bool
-operator<(Z<S, N, P> const& x, I const& y) noexcept
+auto
+operator+(Z<S, N, Wrap> const& x, Z<S, N, Wrap> const& y) noexcept
+    -> Z<S, N, Wrap>
 {
-    using R = std::common_type_t<decltype(x), decltype(y)>;
-    return R{x} < R{y};
+    using R = Z<S, N, Wrap>;
+    if constexpr (N <= Nlimit)
+    {
+        using rep = typename R::rep;
+        using U = typename R::urep_t;
+        return R(rep(U(rep{x}) + U(rep{y})));
+    }
+    else
+    {
+        return x.add(y);
+    }
 }
 
-template <SignTag S, unsigned N, Policy P, std::floating_point I>
+// + Saturate
+
+template <SignTag S, unsigned N>
 constexpr
 inline
-bool
-operator<(I const& x, Z<S, N, P> const& y) noexcept
+auto
+operator+(Z<S, N, Saturate> const& x, Z<S, N, Saturate> const& y) noexcept
+    -> Z<S, N, Saturate>
 {
-    using R = std::common_type_t<decltype(x), decltype(y)>;
-    return R{x} < R{y};
+    using R = Z<S, N, Saturate>;
+    using RW = Z<Unsigned, N, Wrap>;
+    if constexpr (S{} == Unsigned{})
+    {
+        auto const xw = RW{x};
+        auto r = xw + RW{y};
+        r |= RW{-(r < xw)};
+        return R{r};
+    }
+    else  // S is Signed
+    {
+        RW xw{x};
+        RW yw{y};
+        auto r = xw + yw;
+        RW constexpr M{std::numeric_limits<R>::max()};
+        xw = RW{xw.high_bit()} + M;
+        if (!((xw ^ yw) | ~(yw ^ r)).high_bit())
+            r = xw;
+        using SW = Z<Signed, N, Wrap>;
+        return R{SW{r}};
+    }
 }
 
-#endif  // BBI_FLOAT_CONVERT
+// + Throw / Terminate
 
-template <SignTag S1, unsigned N1, Policy P, SignTag S2, unsigned N2>
+template <SignTag S, unsigned N, ErrorCheckedPolicy P>
+constexpr
 inline
+auto
+operator+(Z<S, N, P> const& x, Z<S, N, P> const& y) noexcept(P{} == Terminate{})
+    -> Z<S, N, P>
+{
+    using R = Z<S, N, P>;
+    using RW = Z<Unsigned, N, Wrap>;
+    if constexpr (S{} == Unsigned{})
+    {
+        auto const xw = RW{x};
+        auto r = xw + RW{y};
+        if (r < xw)
+        {
+            auto const msg = to_string<R>() + '{' + to_string(x) + "} + " +
+                             to_string<R>() + '{' + to_string(y) + "} overflowed";
+            if constexpr (P{} == Throw{})
+                throw std::overflow_error(msg);
+            else
+            {
+                std::cerr << msg << '\n';
+                std::terminate();
+            }
+        }
+        return R{r};
+    }
+    else  // S is Signed
+    {
+        RW xw{x};
+        RW yw{y};
+        auto r = xw + yw;
+        RW constexpr M{std::numeric_limits<R>::max()};
+        xw = RW{xw.high_bit()} + M;
+        if (!((xw ^ yw) | ~(yw ^ r)).high_bit())
+        {
+            auto const msg = to_string<R>() + '{' + to_string(x) + "} + " +
+                             to_string<R>() + '{' + to_string(y) + "} overflowed";
+            if constexpr (P{} == Throw{})
+                throw std::overflow_error(msg);
+            else
+            {
+                std::cerr << msg << '\n';
+                std::terminate();
+            }
+        }
+        using SW = Z<Signed, N, Wrap>;
+        return R{SW{r}};
+    }
+}
+
+template <SignTag S1, unsigned N1, Policy P, SignTag S2, unsigned N2>
 constexpr
-bool
-operator>(Z<S1, N1, P> const& x, Z<S2, N2, P> const& y) noexcept
+inline
+auto
+operator+(Z<S1, N1, P> const& x, Z<S2, N2, P> const& y) noexcept(P{} != Throw{})
+    -> std::common_type_t<decltype(x), decltype(y)>
 {
-    return y < x;
+    using X = decltype(x);
+    using Y = decltype(y);
+    using R = std::common_type_t<X, Y>;
+    return R{x} + R{y};
 }
 
 template <SignTag S, unsigned N, Policy P, detail::StandardInteger I>
 constexpr
 inline
-bool
-operator>(Z<S, N, P> const& x, I const& y) noexcept
+auto
+operator+(Z<S, N, P> const& x, I const& i) noexcept(P{} != Throw{})
+    -> std::common_type_t<decltype(x), decltype(i)>
 {
-    return y < x;
+    using X = decltype(x);
+    using R = std::common_type_t<X, I>;
+    return R{x} + R{i};
 }
 
 template <SignTag S, unsigned N, Policy P, detail::StandardInteger I>
 constexpr
 inline
-bool
-operator>(I const& x, Z<S, N, P> const& y) noexcept
+auto
+operator+(I const& i, Z<S, N, P> const& y) noexcept(P{} != Throw{})
+    -> std::common_type_t<decltype(i), decltype(y)>
 {
-    return y < x;
+    return y + i;
 }
 
-#if BBI_FLOAT_CONVERT
+// - Wrap
 
-template <SignTag S, unsigned N, Policy P, std::floating_point I>
+template <SignTag S2, unsigned N2>
 constexpr
 inline
-bool
-operator>(Z<S, N, P> const& x, I const& y) noexcept
+auto
+operator-(Z<S2, N2, Wrap> const& x, Z<S2, N2, Wrap> const& y) noexcept
+    -> Z<S2, N2, Wrap>
 {
-    return y < x;
+    using R = Z<S2, N2, Wrap>;
+    if constexpr (N2 <= Nlimit)
+    {
+        using rep = typename R::rep;
+        using U = typename R::urep_t;
+        return R(rep(U(x) - U(y)));
+    }
+    else
+    {
+        return x.sub(y);
+    }
 }
 
-template <SignTag S, unsigned N, Policy P, std::floating_point I>
+template <SignTag S, unsigned N>
 constexpr
 inline
-bool
-operator>(I const& x, Z<S, N, P> const& y) noexcept
+auto
+operator-(Z<S, N, Wrap> const& x) noexcept
+    -> Z<S, N, Wrap>
 {
-    return y < x;
+    using R = Z<S, N, Wrap>;
+    if constexpr (N <= Nlimit)
+    {
+        using rep = typename R::rep;
+        using U = typename R::urep_t;
+        return R(rep(-U(x)));
+    }
+    else
+    {
+        return R{} - x;
+    }
 }
 
-#endif  // BBI_FLOAT_CONVERT
+// - Saturate
 
-template <SignTag S1, unsigned N1, Policy P, SignTag S2, unsigned N2>
-inline
+template <SignTag S, unsigned N>
 constexpr
-bool
-operator<=(Z<S1, N1, P> const& x, Z<S2, N2, P> const& y) noexcept
-{
-    return !(y < x);
-}
-
-template <SignTag S, unsigned N, Policy P, detail::StandardInteger I>
 inline
-constexpr
-bool
-operator<=(Z<S, N, P> const& x, I const& y) noexcept
+auto
+operator-(Z<S, N, Saturate> const& x, Z<S, N, Saturate> const& y) noexcept
+    -> Z<S, N, Saturate>
 {
-    return !(y < x);
+    using R = Z<S, N, Saturate>;
+    using RW = Z<Unsigned, N, Wrap>;
+    if constexpr (S{} == Unsigned{})
+    {
+        auto const xw = RW{x};
+        RW r = xw - RW{y};
+        if (r > xw)
+            r = RW{};
+        return R{r};
+    }
+    else  // S is Signed
+    {
+        RW xw{x};
+        RW yw{y};
+        auto r = xw - yw;
+        RW constexpr M{std::numeric_limits<R>::max()};
+        xw = RW{xw.high_bit()} + M;
+        if (((xw ^ yw) & (xw ^ r)).high_bit())
+            r = xw;
+        using SW = Z<Signed, N, Wrap>;
+        return R{SW{r}};
+    }
 }
 
-template <SignTag S, unsigned N, Policy P, detail::StandardInteger I>
-inline
+template <SignTag S, unsigned N>
 constexpr
-bool
-operator<=( I const& x, Z<S, N, P> const& y) noexcept
+inline
+auto
+operator-(Z<S, N, Saturate> const& x) noexcept
+    -> Z<S, N, Saturate>
 {
-    return !(y < x);
+    using R = Z<S, N, Saturate>;
+    if constexpr (S{} == Unsigned{})
+    {
+        return R{};
+    }
+    else  // S is Signed
+    {
+        using RW = Z<Unsigned, N, Wrap>;
+        RW xw{x};
+        auto r = -xw;
+        RW constexpr M{std::numeric_limits<R>::max()};
+        if (xw.high_bit() && r.high_bit())
+            r = M;
+        using SW = Z<Signed, N, Wrap>;
+        return R{SW{r}};
+    }
 }
 
-#if BBI_FLOAT_CONVERT
+// - Throw / Terminate
 
-template <SignTag S, unsigned N, Policy P, std::floating_point I>
-inline
+template <SignTag S, unsigned N, ErrorCheckedPolicy P>
 constexpr
-bool
-operator<=(Z<S, N, P> const& x, I const& y) noexcept
+inline
+auto
+operator-(Z<S, N, P> const& x, Z<S, N, P> const& y) noexcept(P{} == Terminate{})
+    -> Z<S, N, P>
 {
-    return !(y < x);
+    using R = Z<S, N, P>;
+    using RW = Z<Unsigned, N, Wrap>;
+    if constexpr (S{} == Unsigned{})
+    {
+        auto const xw = RW{x};
+        auto r = xw - RW{y};
+        if (r > xw)
+        {
+            auto const msg = to_string<R>() + '{' + to_string(x) + "} - " +
+                             to_string<R>() + '{' + to_string(y) + "} overflowed";
+            if constexpr (P{} == Throw{})
+                throw std::overflow_error(msg);
+            else
+            {
+                std::cerr << msg << '\n';
+                std::terminate();
+            }
+        }
+        return R{r};
+    }
+    else  // S is Signed
+    {
+        RW xw{x};
+        RW yw{y};
+        auto r = xw - yw;
+        RW constexpr M{std::numeric_limits<R>::max()};
+        xw = RW{xw.high_bit()} + M;
+        if (((xw ^ yw) & (xw ^ r)).high_bit())
+        {
+            auto const msg = to_string<R>() + '{' + to_string(x) + "} - " +
+                             to_string<R>() + '{' + to_string(y) + "} overflowed";
+            if constexpr (P{} == Throw{})
+                throw std::overflow_error(msg);
+            else
+            {
+                std::cerr << msg << '\n';
+                std::terminate();
+            }
+        }
+        using SW = Z<Signed, N, Wrap>;
+        return R{SW{r}};
+    }
 }
 
-template <SignTag S, unsigned N, Policy P, std::floating_point I>
-inline
+template <SignTag S, unsigned N, ErrorCheckedPolicy P>
 constexpr
-bool
-operator<=( I const& x, Z<S, N, P> const& y) noexcept
+inline
+auto
+operator-(Z<S, N, P> const& x) noexcept(P{} == Terminate{})
+    -> Z<S, N, P>
 {
-    return !(y < x);
+    using R = Z<S, N, P>;
+    if constexpr (S{} == Unsigned{})
+    {
+        if (x)
+        {
+            auto const msg = '-' +
+                             to_string<R>() + '{' + to_string(x) + "} overflowed";
+            if constexpr (P{} == Throw{})
+                throw std::overflow_error(msg);
+            else
+            {
+                std::cerr << msg << '\n';
+                std::terminate();
+            }
+        }
+        return x;
+    }
+    else  // S is Signed
+    {
+        using RW = Z<Unsigned, N, Wrap>;
+        RW xw{x};
+        auto r = -xw;
+        if (xw.high_bit() && r.high_bit())
+        {
+            auto const msg = '-' +
+                             to_string<R>() + '{' + to_string(x) + "} overflowed";
+            if constexpr (P{} == Throw{})
+                throw std::overflow_error(msg);
+            else
+            {
+                std::cerr << msg << '\n';
+                std::terminate();
+            }
+        }
+        using SW = Z<Signed, N, Wrap>;
+        return R{SW{r}};
+    }
 }
 
-#endif  // BBI_FLOAT_CONVERT
-
 template <SignTag S1, unsigned N1, Policy P, SignTag S2, unsigned N2>
-inline
 constexpr
-bool
-operator>=(Z<S1, N1, P> const& x, Z<S2, N2, P> const& y) noexcept
+inline
+auto
+operator-(Z<S1, N1, P> const& x, Z<S2, N2, P> const& y) noexcept(P{} != Throw{})
+    -> std::common_type_t<decltype(x), decltype(y)>
 {
-    return !(x < y);
+    using X = decltype(x);
+    using Y = decltype(y);
+    using R = std::common_type_t<X, Y>;
+    auto z = R{x} - R{y};
+    return z;
 }
 
 template <SignTag S, unsigned N, Policy P, detail::StandardInteger I>
-inline
 constexpr
-bool
-operator>=(Z<S, N, P> const& x, I const& y) noexcept
+inline
+auto
+operator-(Z<S, N, P> const& x, I const& i) noexcept(P{} != Throw{})
+    -> std::common_type_t<decltype(x), decltype(i)>
 {
-    return !(x < y);
+    using X = decltype(x);
+    using R = std::common_type_t<X, I>;
+    return R{x} - R{i};
 }
 
 template <SignTag S, unsigned N, Policy P, detail::StandardInteger I>
-inline
 constexpr
-bool
-operator>=(I const& x, Z<S, N, P> const& y) noexcept
+inline
+auto
+operator-(I const& i, Z<S, N, P> const& y) noexcept(P{} != Throw{})
+    -> std::common_type_t<decltype(i), decltype(y)>
 {
-    return !(x < y);
+    using Y = decltype(y);
+    using R = std::common_type_t<I, Y>;
+    return R{i} - R{y};
 }
 
-#if BBI_FLOAT_CONVERT
+// abs
 
-template <SignTag S, unsigned N, Policy P, std::floating_point I>
-inline
+template <unsigned N, Policy P>
 constexpr
-bool
-operator>=(Z<S, N, P> const& x, I const& y) noexcept
-{
-    return !(x < y);
-}
-
-template <SignTag S, unsigned N, Policy P, std::floating_point I>
 inline
-constexpr
-bool
-operator>=(I const& x, Z<S, N, P> const& y) noexcept
+auto
+abs(Z<Signed, N, P> const& x)
 {
-    return !(x < y);
+    auto y = x >> std::numeric_limits<Z<Signed, N, P>>::digits;
+    return (x ^ y) - y;
 }
 
-#endif  // BBI_FLOAT_CONVERT
+// countl_zero
 
-template <SignTag S, unsigned N>
-inline
+template <unsigned N, Policy P>
 constexpr
-Z<S, N, Wrap>
-operator<<(Z<S, N, Wrap> const& x, int n) noexcept
-{
-    constexpr unsigned mask = N-1;
-    n &= mask;
-    return x.left_shift(n);
-}
-
-template <SignTag S, unsigned N>
 inline
-constexpr
-Z<S, N, Wrap>
-operator>>(Z<S, N, Wrap> const& x, int n) noexcept
+unsigned
+countl_zero(Z<Unsigned, N, P> const& x) noexcept
 {
-    constexpr unsigned mask = N-1;
-    n &= mask;
-    if constexpr (S{} == Signed{})
-        return x.right_shift_signed(n);
+    if constexpr (N <= Nlimit)
+    {
+        return std::countl_zero(x.rep_);
+    }
     else
-        return x.right_shift_unsigned(n);
+    {
+        auto constexpr n = Z<Unsigned, N, P>::nlimbs;
+        for (auto j = n; j-- > 0;)
+        {
+            if (x.limbs_[j])
+                return (n-1-j)*detail::limb_bits + std::countl_zero(x.limbs_[j]);
+        }
+        return N;
+    }
 }
 
-template <SignTag S, unsigned N>
-inline
+// countl_one
+
+template <unsigned N, Policy P>
 constexpr
-Z<S, N, Saturate>
-operator<<(Z<S, N, Saturate> const& x, int n) noexcept
+inline
+unsigned
+countl_one(Z<Unsigned, N, P> const& x) noexcept
 {
-    using X = Z<S, N, Saturate>;
-    if (n < 0)
-    {
-        if (n == std::numeric_limits<int>::min())
-            ++n;
-        return x >> -n;
-    }
-    if (static_cast<unsigned>(n) >= N)
-        return X{};
-    return x.left_shift(unsigned(n));
+    return countl_zero(~x);
 }
 
-template <SignTag S, unsigned N>
-inline
+// countr_zero
+
+template <unsigned N, Policy P>
 constexpr
-Z<S, N, Saturate>
-operator>>(Z<S, N, Saturate> const& x, int n) noexcept
+inline
+unsigned
+countr_zero(Z<Unsigned, N, P> const& x) noexcept
 {
-    using X = Z<S, N, Saturate>;
-    if (n < 0)
+    if constexpr (N <= Nlimit)
     {
-        if (n == std::numeric_limits<int>::min())
-            ++n;
-        return x << -n;
+        return std::countr_zero(x.rep_);
     }
-    if (static_cast<unsigned>(n) >= N)
+    else
     {
-        if (x.is_neg())
+        auto constexpr n = Z<Unsigned, N, P>::nlimbs;
+        for (unsigned j = 0; j < n; ++j)
         {
-            auto constexpr ones = ~X{};
-            return ones;
+            if (x.limbs_[j])
+                return j*detail::limb_bits + std::countr_zero(x.limbs_[j]);
         }
-        auto constexpr zeroes = X{};
-        return zeroes;
+        return N;
     }
-    if constexpr (S{} == Signed{})
-        return x.right_shift_signed(unsigned(n));
-    else
-        return x.right_shift_unsigned(unsigned(n));
 }
 
-template <SignTag S, unsigned N, ErrorCheckedPolicy P>
+// countr_one
+
+template <unsigned N, Policy P>
+constexpr
 inline
+unsigned
+countr_one(Z<Unsigned, N, P> const& x) noexcept
+{
+    return countr_zero(~x);
+}
+
+// popcount
+
+template <unsigned N, Policy P>
 constexpr
-Z<S, N, P>
-operator<<(Z<S, N, P> const& x, int n) noexcept(P{} == Terminate{})
+inline
+unsigned
+popcount(Z<Unsigned, N, P> const& x) noexcept
 {
-    using X = Z<S, N, P>;
-    if (n < 0 || static_cast<unsigned>(n) >= N)
+    if constexpr (N <= Nlimit)
     {
-        auto const msg = to_string<X>() + '{' + to_string(x) + "} << " +
-                         std::to_string(n) + " overflowed";
-        if constexpr (P{} == Throw{})
-            throw std::overflow_error(msg);
-        else
-        {
-            std::cerr << msg << '\n';
-            std::terminate();
-        }
+        return std::popcount(x.rep_);
+    }
+    else
+    {
+        unsigned r = 0;
+        for (auto l : x.limbs_)
+            r += std::popcount(l);
+        return r;
     }
-    return x.left_shift(unsigned(n));
 }
 
-template <SignTag S, unsigned N, ErrorCheckedPolicy P>
-inline
+// * Wrap
+
+namespace detail
+{
+
+template <unsigned N>
 constexpr
-Z<S, N, P>
-operator>>(Z<S, N, P> const& x, int n) noexcept(P{} == Terminate{})
+inline
+Z<Unsigned, 2*N, Wrap>
+mul2(Z<Unsigned, N, Wrap> const& x, Z<Unsigned, N, Wrap> const& y) noexcept
 {
-    using X = Z<S, N, P>;
-    if (n < 0 || static_cast<unsigned>(n) >= N)
+    using R2 = Z<Unsigned, 2*N, Wrap>;
+    if constexpr (N < Nlimit || N == 8)
     {
-        auto const msg = to_string<X>() + '{' + to_string(x) + "} >> " +
-                         std::to_string(n) + " overflowed";
-        if constexpr (P{} == Throw{})
-            throw std::overflow_error(msg);
+        using rep2 = std::tuple_element_t<std::countr_zero(2*N) - 3,
+                                          typename Z<Unsigned, 8, Wrap>::utypes>;
+        return R2{rep2{x.rep_}*rep2{y.rep_}};
+    }
+    else  // N >= Nlimit && N >= 16
+    {
+        R2 r2;
+        auto constexpr n = R2::nlimbs/2;
+        if constexpr (N > Nlimit)
+        {
+            detail::mul_n<n>(r2.limbs_.data(), x.limbs_.data(), y.limbs_.data());
+        }
         else
         {
-            std::cerr << msg << '\n';
-            std::terminate();
+            // Spread the native operands over limbs
+            R2 const xw{x};
+            R2 const yw{y};
+            detail::mul_basecase(r2.limbs_.data(), xw.limbs_.data(), n,
+                                                   yw.limbs_.data(), n);
         }
+        return r2;
     }
-    if constexpr (S{} == Signed{})
-        return x.right_shift_signed(unsigned(n));
-    else
-        return x.right_shift_unsigned(unsigned(n));
 }
 
-template <SignTag S, unsigned N, Policy P>
-inline
+template <unsigned N>
 constexpr
-Z<S, N, P>
-operator<<(Z<S, N, P> const& x, Z<S, N, P> const& y) noexcept
-{
-    return x << static_cast<int>(y);
-}
-
-template <SignTag S, unsigned N, Policy P>
 inline
-constexpr
-Z<S, N, P>
-operator>>(Z<S, N, P> const& x, Z<S, N, P> const& y) noexcept
+Z<Signed, 2*N, Wrap>
+mul2(Z<Signed, N, Wrap> const& x, Z<Signed, N, Wrap> const& y) noexcept
 {
-    return x >> static_cast<int>(y);
+    using R2 = Z<Signed, 2*N, Wrap>;
+    if constexpr (N < Nlimit || N == 8)
+    {
+        using rep2 = std::tuple_element_t<std::countr_zero(2*N) - 3,
+                                          typename Z<Signed, 8, Wrap>::stypes>;
+        using rep = std::tuple_element_t<std::countr_zero(N) - 3,
+                                          typename Z<Signed, 8, Wrap>::stypes>;
+        return R2{rep2{rep(x.rep_)}*rep2{rep(y.rep_)}};
+    }
+    else  // N >= Nlimit && N >= 16
+    {
+        using RU = Z<Unsigned, N, Wrap>;
+        auto r2u = mul2(RU{x}, RU{y});
+        using R2U = decltype(r2u);
+        if (x.is_neg())
+            r2u -= R2U{y} << N;
+        if (y.is_neg())
+            r2u -= R2U{x} << N;
+        return R2{r2u};
+    }
 }
 
-template <SignTag S, unsigned N, Policy P>
-inline
+template <unsigned N>
 constexpr
-Z<S, N, P>
-operator~(Z<S, N, P> const& x) noexcept
+inline
+Z<Unsigned, 2*N, Wrap>
+sqr2(Z<Unsigned, N, Wrap> const& x) noexcept
 {
-    Z<S, N, P> r;
-    if constexpr (N <= Nlimit)
+    using R2 = Z<Unsigned, 2*N, Wrap>;
+    if constexpr (N < Nlimit || N == 8)
     {
-        using urep_t = typename Z<S, N, P>::urep_t;
-        r.rep_ = urep_t(~x.rep_);
+        return mul2(x, x);
     }
-    else
+    else  // N >= Nlimit && N >= 16
     {
-        r.lo_ = ~x.lo_;
-        r.hi_ = ~x.hi_;
+        R2 r2;
+        auto constexpr n = R2::nlimbs/2;
+        if constexpr (N > Nlimit)
+        {
+            detail::sqr_n<n>(r2.limbs_.data(), x.limbs_.data());
+        }
+        else
+        {
+            // Spread the native operand over limbs
+            R2 const xw{x};
+            detail::sqr_n<n>(r2.limbs_.data(), xw.limbs_.data());
+        }
+        return r2;
     }
-    return r;
 }
 
-template <SignTag S, unsigned N, Policy P>
-inline
+template <unsigned N>
 constexpr
-Z<S, N, P>
-operator&(Z<S, N, P> const& x, Z<S, N, P> const& y) noexcept
+inline
+Z<Signed, 2*N, Wrap>
+sqr2(Z<Signed, N, Wrap> const& x) noexcept
 {
-    Z<S, N, P> r;
-    if constexpr (N <= Nlimit)
+    using R2 = Z<Signed, 2*N, Wrap>;
+    if constexpr (N < Nlimit || N == 8)
     {
-        using urep_t = typename Z<S, N, P>::urep_t;
-        r.rep_ = urep_t(x.rep_ & y.rep_);
+        return mul2(x, x);
     }
-    else
+    else  // N >= Nlimit && N >= 16
     {
-        r.lo_ = x.lo_ & y.lo_;
-        r.hi_ = x.hi_ & y.hi_;
+        // x^2 == |x|^2, and |x| always fits in the unsigned type
+        using RU = Z<Unsigned, N, Wrap>;
+        return R2{sqr2(x.is_neg() ? -RU{x} : RU{x})};
     }
-    return r;
 }
 
-template <SignTag S1, unsigned N1, Policy P, SignTag S2, unsigned N2>
+}  // namespace detail
+
+template <SignTag S, unsigned N>
 constexpr
 inline
 auto
-operator&(Z<S1, N1, P> const& x, Z<S2, N2, P> const& y) noexcept(P{} != Throw{})
-    -> std::common_type_t<decltype(x), decltype(y)>
+operator*(Z<S, N, Wrap> const& x, Z<S, N, Wrap> const& y) noexcept
+    -> Z<S, N, Wrap>
 {
-    using X = decltype(x);
-    using Y = decltype(y);
-    using R = std::common_type_t<X, Y>;
-    return R{x} & R{y};
+    using R = Z<S, N, Wrap>;
+    if constexpr (N <= Nlimit)
+        return R{detail::mul2(x, y)};
+    else
+        return x.mullo(y);  // only the low N bits are needed
 }
 
-template <SignTag S, unsigned N, Policy P, detail::StandardInteger I>
+// * Saturate
+
+template <SignTag S, unsigned N>
 constexpr
 inline
 auto
-operator&(Z<S, N, P> const& x, I const& i) noexcept(P{} != Throw{})
-    -> std::common_type_t<decltype(x), decltype(i)>
+operator*(Z<S, N, Saturate> const& x, Z<S, N, Saturate> const& y) noexcept
+    -> Z<S, N, Saturate>
 {
-    using X = decltype(x);
-    using R = std::common_type_t<X, I>;
-    return R{x} & R{i};
+    using R = Z<S, N, Saturate>;
+    using RW = Z<S, N, Wrap>;
+    return R{detail::mul2(RW{x}, RW{y})};
 }
 
-template <SignTag S, unsigned N, Policy P, detail::StandardInteger I>
+// * Throw / Terminate
+
+template <unsigned N, ErrorCheckedPolicy P>
 constexpr
 inline
 auto
-operator&(I const& i, Z<S, N, P> const& y) noexcept(P{} != Throw{})
-    -> std::common_type_t<decltype(i), decltype(y)>
+operator*(Z<Unsigned, N, P> const& x, Z<Unsigned, N, P> const& y)
+    noexcept(P{} == Terminate{})
+    -> Z<Unsigned, N, P>
 {
-    return y & i;
+    using R = Z<Unsigned, N, P>;
+    using RW = Z<Unsigned, N, Wrap>;
+    auto r2 = detail::mul2(RW{x}, RW{y});
+    R hi{RW{r2 >> N}};
+    R lo{RW{r2}};
+    if (hi)
+    {
+        auto const msg = to_string<R>() + '{' + to_string(x) + "} * " +
+                         to_string<R>() + '{' + to_string(y) + "} overflowed";
+        if constexpr (P{} == Throw{})
+            throw std::overflow_error(msg);
+        else
+        {
+            std::cerr << msg << '\n';
+            std::terminate();
+        }
+    }
+    return lo;
 }
 
-template <SignTag S, unsigned N, Policy P>
-inline
+template <unsigned N, ErrorCheckedPolicy P>
 constexpr
-Z<S, N, P>
-operator^(Z<S, N, P> const& x, Z<S, N, P> const& y) noexcept
+inline
+auto
+operator*(Z<Signed, N, P> const& x, Z<Signed, N, P> const& y) noexcept(P{} == Terminate{})
+    -> Z<Signed, N, P>
 {
-    Z<S, N, P> r;
-    if constexpr (N <= Nlimit)
-    {
-        using urep_t = typename Z<S, N, P>::urep_t;
-        r.rep_ = urep_t(x.rep_ ^ y.rep_);
-    }
-    else
+    using R = Z<Signed, N, P>;
+    using RW = Z<Signed, N, Wrap>;
+    auto r2 = detail::mul2(RW{x}, RW{y});
+    R hi{RW{r2 >> N}};
+    R lo{RW{r2}};
+    if (hi != (lo >> (N-1)))
     {
-        r.lo_ = x.lo_ ^ y.lo_;
-        r.hi_ = x.hi_ ^ y.hi_;
+        auto const msg = to_string<R>() + '{' + to_string(x) + ") * " +
+                         to_string<R>() + '{' + to_string(y) + ") overflowed";
+        if constexpr (P{} == Throw{})
+            throw std::overflow_error(msg);
+        else
+        {
+            std::cerr << msg << '\n';
+            std::terminate();
+        }
     }
-    return r;
+    return lo;
 }
 
 template <SignTag S1, unsigned N1, Policy P, SignTag S2, unsigned N2>
 constexpr
 inline
 auto
-operator^(Z<S1, N1, P> const& x, Z<S2, N2, P> const& y) noexcept(P{} != Throw{})
+operator*(Z<S1, N1, P> const& x, Z<S2, N2, P> const& y) noexcept(P{} != Throw{})
     -> std::common_type_t<decltype(x), decltype(y)>
 {
     using X = decltype(x);
     using Y = decltype(y);
     using R = std::common_type_t<X, Y>;
-    return R{x} ^ R{y};
+    auto z = R{x} * R{y};
+    return z;
 }
 
 template <SignTag S, unsigned N, Policy P, detail::StandardInteger I>
 constexpr
 inline
 auto
-operator^(Z<S, N, P> const& x, I const& i) noexcept(P{} != Throw{})
+operator*(Z<S, N, P> const& x, I const& i) noexcept(P{} != Throw{})
     -> std::common_type_t<decltype(x), decltype(i)>
 {
     using X = decltype(x);
     using R = std::common_type_t<X, I>;
-    return R{x} ^ R{i};
+    return R{x} * R{i};
 }
 
 template <SignTag S, unsigned N, Policy P, detail::StandardInteger I>
 constexpr
 inline
 auto
-operator^(I const& i, Z<S, N, P> const& y) noexcept(P{} != Throw{})
+operator*(I const& i, Z<S, N, P> const& y) noexcept(P{} != Throw{})
     -> std::common_type_t<decltype(i), decltype(y)>
 {
-    return y ^ i;
+    return y * i;
 }
 
+// square
+
 template <SignTag S, unsigned N, Policy P>
-inline
 constexpr
-Z<S, N, P>
-operator|(Z<S, N, P> const& x, Z<S, N, P> const& y) noexcept
+inline
+auto
+square(Z<S, N, P> const& x) noexcept(P{} != Throw{})
+    -> Z<S, N, P>
 {
-    Z<S, N, P> r;
-    if constexpr (N <= Nlimit)
+    using R = Z<S, N, P>;
+    using RW = Z<S, N, Wrap>;
+    if constexpr (P{} == Wrap{})
     {
-        using urep_t = typename Z<S, N, P>::urep_t;
-        r.rep_ = urep_t(x.rep_ | y.rep_);
+        return x * x;  // squares when both operands are the same object
+    }
+    else if constexpr (P{} == Saturate{})
+    {
+        return R{detail::sqr2(RW{x})};
     }
     else
     {
-        r.lo_ = x.lo_ | y.lo_;
-        r.hi_ = x.hi_ | y.hi_;
+        auto const r2 = detail::sqr2(RW{x});
+        // x*x is never negative
+        using R2W = decltype(r2);
+        if (r2 > R2W{std::numeric_limits<RW>::max()})
+        {
+            auto const msg = "square(" + to_string<R>() + '{' + to_string(x) +
+                             "}) overflowed";
+            if constexpr (P{} == Throw{})
+                throw std::overflow_error(msg);
+            else
+            {
+                std::cerr << msg << '\n';
+                std::terminate();
+            }
+        }
+        return R{RW{r2}};
     }
-    return r;
 }
 
-template <SignTag S1, unsigned N1, Policy P, SignTag S2, unsigned N2>
+// /
+
+template <unsigned N>
 constexpr
 inline
 auto
-operator|(Z<S1, N1, P> const& x, Z<S2, N2, P> const& y) noexcept(P{} != Throw{})
-    -> std::common_type_t<decltype(x), decltype(y)>
+operator/(Z<Unsigned, N, Wrap> const& x, Z<Unsigned, N, Wrap> const& y) noexcept
+    -> Z<Unsigned, N, Wrap>
 {
-    using X = decltype(x);
-    using Y = decltype(y);
-    using R = std::common_type_t<X, Y>;
-    return R{x} | R{y};
+    using R = Z<Unsigned, N, Wrap>;
+    if constexpr (N <= Nlimit)
+    {
+        return R{x.rep_ / y.rep_};
+    }
+    else
+    {
+        R r;
+        return x.divrem(y, r);
+    }
 }
 
-template <SignTag S, unsigned N, Policy P, detail::StandardInteger I>
+template <unsigned N>
 constexpr
 inline
 auto
-operator|(Z<S, N, P> const& x, I const& i) noexcept(P{} != Throw{})
-    -> std::common_type_t<decltype(x), decltype(i)>
+operator/(Z<Unsigned, N, Saturate> const& x,
+          Z<Unsigned, N, Saturate> const& y) noexcept
+    -> Z<Unsigned, N, Saturate>
 {
-    using X = decltype(x);
-    using R = std::common_type_t<X, I>;
-    return R{x} | R{i};
+    using R  = Z<Unsigned, N, Saturate>;
+    using RW = Z<Unsigned, N, Wrap>;
+
+    if (!y)
+        return std::numeric_limits<R>::max();
+    return R{RW{x}/RW{y}};
 }
 
-template <SignTag S, unsigned N, Policy P, detail::StandardInteger I>
+template <unsigned N, ErrorCheckedPolicy P>
 constexpr
 inline
 auto
-operator|(I const& i, Z<S, N, P> const& y) noexcept(P{} != Throw{})
-    -> std::common_type_t<decltype(i), decltype(y)>
+operator/(Z<Unsigned, N, P> const& x, Z<Unsigned, N, P> const& y)
+    noexcept(P{} == Terminate{})
+    -> Z<Unsigned, N, P>
 {
-    return y | i;
-}
+    using R  = Z<Unsigned, N, P>;
+    using RW = Z<Unsigned, N, Wrap>;
 
-// + Wrap
+    if (!y)
+    {
+        auto const msg = to_string<R>() + '{' + to_string(x) + "} / 0";
+        if constexpr (P{} == Throw{})
+            throw std::overflow_error(msg);
+        else
+        {
+            std::cerr << msg << '\n';
+            std::terminate();
+        }
+    }
+    return R{RW{x}/RW{y}};
+}
 
-template <SignTag S, unsigned N>
+template <unsigned N>
 constexpr
 inline
 auto
-operator+(Z<S, N, Wrap> const& x, Z<S, N, Wrap> const& y) noexcept
-    -> Z<S, N, Wrap>
+operator/(Z<Signed, N, Wrap> const& x, Z<Signed, N, Wrap> const& y) noexcept
+    -> Z<Signed, N, Wrap>
 {
-    using R = Z<S, N, Wrap>;
+    using R  = Z<Signed, N, Wrap>;
+
     if constexpr (N <= Nlimit)
     {
-        using rep = typename R::rep;
-        using U = typename R::urep_t;
-        return R(rep(U(rep{x}) + U(rep{y})));
+        using I = R::rep;
+        // min / -1 overflows I, and traps on x86
+        if (I(y.rep_) == I(-1))
+            return -x;
+        return R{I(x.rep_)/I(y.rep_)};
     }
     else
     {
-        R r;
-        r.lo_ = x.lo_ + y.lo_;
-        auto c = ((x.lo_ & y.lo_) | ((x.lo_ | y.lo_) & ~r.lo_)) >> (N/2-1);
-        r.hi_ = x.hi_ + y.hi_ + c;
-        return r;
+        using RU = Z<Unsigned, N, Wrap>;
+
+        RU xu{abs(x)};
+        RU yu{abs(y)};
+        auto q = xu / yu;
+        RU t{(x ^ y) >> (N-1)};
+        return R{(q ^ t) - t};
     }
 }
 
-// + Saturate
-
-template <SignTag S, unsigned N>
+template <unsigned N>
 constexpr
 inline
 auto
-operator+(Z<S, N, Saturate> const& x, Z<S, N, Saturate> const& y) noexcept
-    -> Z<S, N, Saturate>
+operator/(Z<Signed, N, Saturate> const& x, Z<Signed, N, Saturate> const& y) noexcept
+    -> Z<Signed, N, Saturate>
 {
-    using R = Z<S, N, Saturate>;
-    using RW = Z<Unsigned, N, Wrap>;
-    if constexpr (S{} == Unsigned{})
-    {
-        auto const xw = RW{x};
-        auto r = xw + RW{y};
-        r |= RW{-(r < xw)};
-        return R{r};
-    }
-    else  // S is Signed
+    using R  = Z<Signed, N, Saturate>;
+    using RS = Z<Signed, N, Wrap>;
+
+    auto constexpr m = std::numeric_limits<R>::min();
+    auto constexpr M = std::numeric_limits<R>::max();
+    auto constexpr n_one = R{-1};
+    if (!y)
     {
-        RW xw{x};
-        RW yw{y};
-        auto r = xw + yw;
-        RW constexpr M{std::numeric_limits<R>::max()};
-        xw = RW{xw.high_bit()} + M;
-        if (!((xw ^ yw) | ~(yw ^ r)).high_bit())
-            r = xw;
-        using SW = Z<Signed, N, Wrap>;
-        return R{SW{r}};
+        if (x >= R{})
+            return M;
+        return m;
     }
+    if (x == m && y == n_one)
+        return M;
+    return R{RS{x}/RS{y}};
 }
 
-// + Throw / Terminate
-
-template <SignTag S, unsigned N, ErrorCheckedPolicy P>
+template <unsigned N, ErrorCheckedPolicy P>
 constexpr
 inline
 auto
-operator+(Z<S, N, P> const& x, Z<S, N, P> const& y) noexcept(P{} == Terminate{})
-    -> Z<S, N, P>
+operator/(Z<Signed, N, P> const& x, Z<Signed, N, P> const& y) noexcept(P{} == Terminate{})
+    -> Z<Signed, N, P>
 {
-    using R = Z<S, N, P>;
-    using RW = Z<Unsigned, N, Wrap>;
-    if constexpr (S{} == Unsigned{})
+    using R  = Z<Signed, N, P>;
+    using RS = Z<Signed, N, Wrap>;
+
+    if (!y)
     {
-        auto const xw = RW{x};
-        auto r = xw + RW{y};
-        if (r < xw)
+        auto const msg = to_string<R>() + '{' + to_string(x) + "} / 0";
+        if constexpr (P{} == Throw{})
+            throw std::overflow_error(msg);
+        else
         {
-            auto const msg = to_string<R>() + '{' + to_string(x) + "} + " +
-                             to_string<R>() + '{' + to_string(y) + "} overflowed";
-            if constexpr (P{} == Throw{})
-                throw std::overflow_error(msg);
-            else
-            {
-                std::cerr << msg << '\n';
-                std::terminate();
-            }
+            std::cerr << msg << '\n';
+            std::terminate();
         }
-        return R{r};
     }
-    else  // S is Signed
+    auto constexpr m = std::numeric_limits<R>::min();
+    auto constexpr n_one = R{-1};
+    if (x == m && y == n_one)
     {
-        RW xw{x};
-        RW yw{y};
-        auto r = xw + yw;
-        RW constexpr M{std::numeric_limits<R>::max()};
-        xw = RW{xw.high_bit()} + M;
-        if (!((xw ^ yw) | ~(yw ^ r)).high_bit())
+        auto const msg = to_string<R>() + '{' + to_string(x) + "} / "
+                       + to_string<R>() + '{' + to_string(y) + "} overflowed";
+        if constexpr (P{} == Throw{})
+            throw std::overflow_error(msg);
+        else
         {
-            auto const msg = to_string<R>() + '{' + to_string(x) + "} + " +
-                             to_string<R>() + '{' + to_string(y) + "} overflowed";
-            if constexpr (P{} == Throw{})
-                throw std::overflow_error(msg);
-            else
-            {
-                std::cerr << msg << '\n';
-                std::terminate();
-            }
+            std::cerr << msg << '\n';
+            std::terminate();
         }
-        using SW = Z<Signed, N, Wrap>;
-        return R{SW{r}};
     }
+    return R{RS{x}/RS{y}};
 }
 
 template <SignTag S1, unsigned N1, Policy P, SignTag S2, unsigned N2>
 constexpr
 inline
 auto
-operator+(Z<S1, N1, P> const& x, Z<S2, N2, P> const& y) noexcept(P{} != Throw{})
+operator/(Z<S1, N1, P> const& x, Z<S2, N2, P> const& y) noexcept(P{} != Throw{})
     -> std::common_type_t<decltype(x), decltype(y)>
 {
     using X = decltype(x);
     using Y = decltype(y);
     using R = std::common_type_t<X, Y>;
-    return R{x} + R{y};
+    auto z = R{x} / R{y};
+    return z;
 }
 
 template <SignTag S, unsigned N, Policy P, detail::StandardInteger I>
 constexpr
 inline
 auto
-operator+(Z<S, N, P> const& x, I const& i) noexcept(P{} != Throw{})
+operator/(Z<S, N, P> const& x, I const& i) noexcept(P{} != Throw{})
     -> std::common_type_t<decltype(x), decltype(i)>
 {
     using X = decltype(x);
     using R = std::common_type_t<X, I>;
-    return R{x} + R{i};
+    return R{x} / R{i};
 }
 
 template <SignTag S, unsigned N, Policy P, detail::StandardInteger I>
 constexpr
 inline
 auto
-operator+(I const& i, Z<S, N, P> const& y) noexcept(P{} != Throw{})
+operator/(I const& i, Z<S, N, P> const& y) noexcept(P{} != Throw{})
     -> std::common_type_t<decltype(i), decltype(y)>
 {
-    return y + i;
+    using Y = decltype(y);
+    using R = std::common_type_t<I, Y>;
+    return R{i} / R{y};
 }
 
-// - Wrap
+template <SignTag S1, unsigned N1, Policy P, SignTag S2, unsigned N2>
+constexpr
+inline
+auto
+operator%(Z<S1, N1, P> const& x, Z<S2, N2, P> const& y) noexcept(P{} != Throw{})
+    -> std::common_type_t<decltype(x), decltype(y)>
+{
+    using X = decltype(x);
+    using Y = decltype(y);
+    using R = std::common_type_t<X, Y>;
+    return divmod(R{x}, R{y}).rem;
+}
 
-template <SignTag S2, unsigned N2>
+template <SignTag S, unsigned N, Policy P, detail::StandardInteger I>
 constexpr
 inline
 auto
-operator-(Z<S2, N2, Wrap> const& x, Z<S2, N2, Wrap> const& y) noexcept
-    -> Z<S2, N2, Wrap>
+operator%(Z<S, N, P> const& x, I const& i) noexcept(P{} != Throw{})
+    -> std::common_type_t<decltype(x), decltype(i)>
 {
-    using R = Z<S2, N2, Wrap>;
-    if constexpr (N2 <= Nlimit)
-    {
-        using rep = typename R::rep;
-        using U = typename R::urep_t;
-        return R(rep(U(x) - U(y)));
-    }
-    else
-    {
-        R r;
-        r.lo_ = x.lo_ - y.lo_;
-        auto b = ((~x.lo_ & y.lo_) | (~(x.lo_ ^ y.lo_) & r.lo_)) >> (N2/2-1);
-        r.hi_ = x.hi_ - y.hi_ - b;
-        return r;
-    }
+    using X = decltype(x);
+    using R = std::common_type_t<X, I>;
+    return R{x} % R{i};
 }
 
-template <SignTag S, unsigned N>
+template <SignTag S, unsigned N, Policy P, detail::StandardInteger I>
 constexpr
 inline
 auto
-operator-(Z<S, N, Wrap> const& x) noexcept
-    -> Z<S, N, Wrap>
+operator%(I const& i, Z<S, N, P> const& y) noexcept(P{} != Throw{})
+    -> std::common_type_t<decltype(i), decltype(y)>
 {
-    using R = Z<S, N, Wrap>;
+    using Y = decltype(y);
+    using R = std::common_type_t<I, Y>;
+    return R{i} % R{y};
+}
+
+namespace detail
+{
+
+template <SignTag S, unsigned N, Policy P>
+constexpr
+Z<S, N, P>
+zero_high_bit(Z<S, N, P> x) noexcept
+{
+    x.zero_high_bit();
+    return x;
+}
+
+template <SignTag S, unsigned N, Policy P>
+constexpr
+Z<S, N, P>
+set_high_bit(Z<S, N, P> x) noexcept
+{
+    x.set_high_bit();
+    return x;
+}
+
+template <unsigned N>
+constexpr
+Z<Unsigned, N, Wrap>
+divrem_1(Z<Unsigned, N, Wrap> const& x, limb_t d, unsigned s, limb_t v, limb_t& r) noexcept
+{
+    using R = Z<Unsigned, N, Wrap>;
     if constexpr (N <= Nlimit)
     {
-        using rep = typename R::rep;
-        using U = typename R::urep_t;
-        return R(rep(-U(x)));
+        // A native integer wider than a limb
+        using rep = R::rep;
+        unsigned constexpr n = N / limb_bits;
+        std::array<limb_t, n> a;
+        for (unsigned j = 0; j < n; ++j)
+            a[j] = limb_t(x.rep_ >> j*limb_bits);
+        r = divrem_1(a.data(), a.data(), n, d, s, v);
+        rep q{};
+        for (unsigned j = n; j-- > 0;)
+            q = rep(q << limb_bits) | a[j];
+        return R{q};
     }
     else
-    {
-        return R{} - x;
-    }
+        return x.divrem_1(d, s, v, r);
 }
 
-// - Saturate
-
-template <SignTag S, unsigned N>
+template <unsigned N>
 constexpr
-inline
-auto
-operator-(Z<S, N, Saturate> const& x, Z<S, N, Saturate> const& y) noexcept
-    -> Z<S, N, Saturate>
+std::array<limb_t, (N + limb_bits - 1) / limb_bits>
+to_limbs(Z<Unsigned, N, Wrap> const& x) noexcept
 {
-    using R = Z<S, N, Saturate>;
-    using RW = Z<Unsigned, N, Wrap>;
-    if constexpr (S{} == Unsigned{})
-    {
-        auto const xw = RW{x};
-        RW r = xw - RW{y};
-        if (r > xw)
-            r = RW{};
-        return R{r};
-    }
-    else  // S is Signed
+    if constexpr (N <= Nlimit)
     {
-        RW xw{x};
-        RW yw{y};
-        auto r = xw - yw;
-        RW constexpr M{std::numeric_limits<R>::max()};
-        xw = RW{xw.high_bit()} + M;
-        if (((xw ^ yw) & (xw ^ r)).high_bit())
-            r = xw;
-        using SW = Z<Signed, N, Wrap>;
-        return R{SW{r}};
+        std::array<limb_t, (N + limb_bits - 1) / limb_bits> a;
+        for (unsigned j = 0; j < a.size(); ++j)
+            a[j] = limb_t(x.rep_ >> j*limb_bits);
+        return a;
     }
+    else
+        return x.limbs_;
 }
 
-template <SignTag S, unsigned N>
+template <unsigned N>
 constexpr
-inline
-auto
-operator-(Z<S, N, Saturate> const& x) noexcept
-    -> Z<S, N, Saturate>
+Z<Unsigned, N, Wrap>
+from_limbs(limb_t const* a) noexcept
 {
-    using R = Z<S, N, Saturate>;
-    if constexpr (S{} == Unsigned{})
+    Z<Unsigned, N, Wrap> x;
+    if constexpr (N <= Nlimit)
     {
-        return R{};
+        using rep = Z<Unsigned, N, Wrap>::rep;
+        unsigned constexpr n = (N + limb_bits - 1) / limb_bits;
+        auto r = rep(a[n-1]);
+        if constexpr (n > 1)
+        {
+            for (unsigned j = n-1; j-- > 0;)
+                r = rep(r << limb_bits) | a[j];
+        }
+        x.rep_ = r;
     }
-    else  // S is Signed
+    else
     {
-        using RW = Z<Unsigned, N, Wrap>;
-        RW xw{x};
-        auto r = -xw;
-        RW constexpr M{std::numeric_limits<R>::max()};
-        if (xw.high_bit() && r.high_bit())
-            r = M;
-        using SW = Z<Signed, N, Wrap>;
-        return R{SW{r}};
+        for (unsigned j = 0; j < x.limbs_.size(); ++j)
+            x.limbs_[j] = a[j];
     }
+    return x;
 }
 
-// - Throw / Terminate
-
-template <SignTag S, unsigned N, ErrorCheckedPolicy P>
+// Returns {x / C, x % C}
+template <std::uint64_t C, unsigned N>
 constexpr
 inline
 auto
-operator-(Z<S, N, P> const& x, Z<S, N, P> const& y) noexcept(P{} == Terminate{})
-    -> Z<S, N, P>
+divmod_by(Z<Unsigned, N, Wrap> const& x) noexcept
+    -> div_t<Z<Unsigned, N, Wrap>>
 {
-    using R = Z<S, N, P>;
-    using RW = Z<Unsigned, N, Wrap>;
-    if constexpr (S{} == Unsigned{})
-    {
-        auto const xw = RW{x};
-        auto r = xw - RW{y};
-        if (r > xw)
-        {
-            auto const msg = to_string<R>() + '{' + to_string(x) + "} - " +
-                             to_string<R>() + '{' + to_string(y) + "} overflowed";
-            if constexpr (P{} == Throw{})
-                throw std::overflow_error(msg);
-            else
-            {
-                std::cerr << msg << '\n';
-                std::terminate();
-            }
-        }
-        return R{r};
-    }
-    else  // S is Signed
-    {
-        RW xw{x};
-        RW yw{y};
-        auto r = xw - yw;
-        RW constexpr M{std::numeric_limits<R>::max()};
-        xw = RW{xw.high_bit()} + M;
-        if (((xw ^ yw) & (xw ^ r)).high_bit())
-        {
-            auto const msg = to_string<R>() + '{' + to_string(x) + "} - " +
-                             to_string<R>() + '{' + to_string(y) + "} overflowed";
-            if constexpr (P{} == Throw{})
-                throw std::overflow_error(msg);
-            else
-            {
-                std::cerr << msg << '\n';
-                std::terminate();
-            }
-        }
-        using SW = Z<Signed, N, Wrap>;
-        return R{SW{r}};
+    using R = Z<Unsigned, N, Wrap>;
+    if constexpr (N < 64 && (C >> N%64) != 0)
+        return {R{}, x};
+    else if constexpr (std::has_single_bit(C))
+        return {x >> std::countr_zero(C), x & R{C-1}};
+    else if constexpr (N <= 64)
+    {
+        // The compiler divides native integers by constants
+        auto const u = std::uint64_t(x);
+        return {R{u / C}, R{u % C}};
+    }
+    else if constexpr (C <= limb_max)
+    {
+        unsigned constexpr s = std::countl_zero(limb_t(C));
+        limb_t constexpr v = reciprocal(limb_t(C << s));
+        limb_t r;
+        auto const q = divrem_1(x, limb_t(C), s, v, r);
+        return {q, R{r}};
     }
+    else
+        return divmod(x, R{C});
 }
 
-template <SignTag S, unsigned N, ErrorCheckedPolicy P>
+template <std::uint64_t C, unsigned N>
 constexpr
 inline
 auto
-operator-(Z<S, N, P> const& x) noexcept(P{} == Terminate{})
-    -> Z<S, N, P>
+divmod_by(Z<Signed, N, Wrap> const& x) noexcept
+    -> div_t<Z<Signed, N, Wrap>>
 {
-    using R = Z<S, N, P>;
-    if constexpr (S{} == Unsigned{})
+    using R  = Z<Signed, N, Wrap>;
+    using RU = Z<Unsigned, N, Wrap>;
+
+    auto const [q, r] = divmod_by<C>(RU{abs(x)});
+    if (x < R{})
+        return {-R{q}, -R{r}};
+    return {R{q}, R{r}};
+}
+
+}  // namespace detail
+
+template <SignTag S, unsigned N, Policy P>
+std::istream&
+operator>>(std::istream& is, Z<S, N, P>& x)
+{
+    using traits = std::istream::traits_type;
+    bool neg = false;
+    std::ws(is);
+    auto ic = is.peek();
+    if (traits::eq_int_type(ic, traits::eof()))
     {
-        if (x)
-        {
-            auto const msg = '-' +
-                             to_string<R>() + '{' + to_string(x) + "} overflowed";
-            if constexpr (P{} == Throw{})
-                throw std::overflow_error(msg);
-            else
-            {
-                std::cerr << msg << '\n';
-                std::terminate();
-            }
-        }
-        return x;
+        is.setstate(std::ios::failbit);
+        return is;
     }
-    else  // S is Signed
+    auto c = static_cast<char>(traits::to_char_type(ic));
+    if (('0' <= c && c <= '9') || c == '-' || c == '+')
     {
-        using RW = Z<Unsigned, N, Wrap>;
-        RW xw{x};
-        auto r = -xw;
-        if (xw.high_bit() && r.high_bit())
+        if (c == '-' || c == '+')
         {
-            auto const msg = '-' +
-                             to_string<R>() + '{' + to_string(x) + "} overflowed";
-            if constexpr (P{} == Throw{})
-                throw std::overflow_error(msg);
-            else
+            (void)is.get();
+            if (c == '-')
+                neg = true;
+            ic = is.peek();
+            if (traits::eq_int_type(ic, traits::eof()))
             {
-                std::cerr << msg << '\n';
-                std::terminate();
+                is.setstate(std::ios::failbit);
+                return is;
+            }
+            c = static_cast<char>(traits::to_char_type(ic));
+            if (!('0' <= c && c <= '9'))
+            {
+                is.setstate(std::ios::failbit);
+                return is;
             }
         }
-        using SW = Z<Signed, N, Wrap>;
-        return R{SW{r}};
+        std::string digits;
+        while (true)
+        {
+            (void)is.get();
+            digits.push_back(c);
+            ic = is.peek();
+            if (traits::eq_int_type(ic, traits::eof()))
+                break;
+            c = static_cast<char>(traits::to_char_type(ic));
+            if (!('0' <= c && c <= '9'))
+                break;
+        }
+        if constexpr (S{} == Signed{})
+            x = detail::from_decimal<Z<S, N, P>>(digits, neg);
+        else
+        {
+            x = detail::from_decimal<Z<S, N, P>>(digits, false);
+            if (neg)
+                x = -x;
+        }
+    }
+    else
+    {
+        is.setstate(std::ios::failbit);
+        return is;
+    }
+    return is;
+}
+
+namespace detail
+{
+
+template <class Z>
+constexpr
+Z
+from_string_view(std::string_view const s, unsigned* count = nullptr)
+{
+    auto const throw_error = [&s]()
+    {
+        throw std::runtime_error('\"' + std::string(s) + "\" is not a valid integer");
+    };
+    unsigned i = 0;
+    if (i == s.size())
+        throw_error();
+    bool neg = false;
+    auto c = s[i];
+    if ((typename Z::sign{} == Signed{} && c == '-') || c == '+')
+    {
+        ++i;
+        if (c == '-')
+            neg = true;
+        if (i == s.size())
+            throw_error();
+        c = s[i];
     }
+    if (!('0' <= c && c <= '9'))
+        throw_error();
+    auto const first = i;
+    for (++i; i < s.size() && '0' <= s[i] && s[i] <= '9'; ++i)
+        ;
+    auto const z = from_decimal<Z>(s.substr(first, i - first), neg);
+    if (count)
+        *count += i;
+    return z;
+}
+
+}  // namespace detail
+
+template <SignTag S, unsigned N, Policy P>
+constexpr
+Z<S, N, P, true>::Z(std::string_view s)
+    : Z{detail::from_string_view<Z>(s)}
+    {}
+
+template <SignTag S, unsigned N, Policy P>
+constexpr
+Z<S, N, P, true>::Z(std::string_view s, unsigned& i)
+    : Z{detail::from_string_view<Z>(s, &i)}
+    {}
+
+template <SignTag S, unsigned N, Policy P>
+constexpr
+Z<S, N, P, false>::Z(std::string_view s)
+    : Z{detail::from_string_view<Z>(s)}
+    {}
+
+template <SignTag S, unsigned N, Policy P>
+constexpr
+Z<S, N, P, false>::Z(std::string_view s, unsigned& i)
+    : Z{detail::from_string_view<Z>(s, &i)}
+    {}
+
+template <SignTag S, unsigned N, Policy P>
+Z<S, N, P, true>::operator std::string() const
+{
+    return to_string(*this);
+}
+
+template <SignTag S, unsigned N, Policy P>
+Z<S, N, P, false>::operator std::string() const
+{
+    return to_string(*this);
 }
 
-template <SignTag S1, unsigned N1, Policy P, SignTag S2, unsigned N2>
-constexpr
-inline
-auto
-operator-(Z<S1, N1, P> const& x, Z<S2, N2, P> const& y) noexcept(P{} != Throw{})
-    -> std::common_type_t<decltype(x), decltype(y)>
+// Policy namespaces
+
+namespace raw
+{
+
+using u8   = std::uint8_t;
+using u16  = std::uint16_t;
+using u32  = std::uint32_t;
+using u64  = std::uint64_t;
+#ifndef _MSVC_LANG
+using u128 = __uint128_t;
+#endif
+
+using i8    = std::int8_t;
+using i16   = std::int16_t;
+using i32   = std::int32_t;
+using i64   = std::int64_t;
+#ifndef _MSVC_LANG
+using i128  = __int128_t;
+#endif
+
+}  // namespace raw
+
+namespace wrap
+{
+
+using u8    = Z<Unsigned,    8, Wrap>;
+using u16   = Z<Unsigned,   16, Wrap>;
+using u32   = Z<Unsigned,   32, Wrap>;
+using u64   = Z<Unsigned,   64, Wrap>;
+using u128  = Z<Unsigned,  128, Wrap>;
+using u256  = Z<Unsigned,  256, Wrap>;
+using u512  = Z<Unsigned,  512, Wrap>;
+using u1024 = Z<Unsigned, 1024, Wrap>;
+using u2048 = Z<Unsigned, 2048, Wrap>;
+using u4096 = Z<Unsigned, 4096, Wrap>;
+
+using i8    = Z<Signed,    8, Wrap>;
+using i16   = Z<Signed,   16, Wrap>;
+using i32   = Z<Signed,   32, Wrap>;
+using i64   = Z<Signed,   64, Wrap>;
+using i128  = Z<Signed,  128, Wrap>;
+using i256  = Z<Signed,  256, Wrap>;
+using i512  = Z<Signed,  512, Wrap>;
+using i1024 = Z<Signed, 1024, Wrap>;
+using i2048 = Z<Signed, 2048, Wrap>;
+using i4096 = Z<Signed, 4096, Wrap>;
+
+}  // namespace wrap
+
+namespace sat
+{
+
+using u8    = Z<Unsigned,    8, Saturate>;
+using u16   = Z<Unsigned,   16, Saturate>;
+using u32   = Z<Unsigned,   32, Saturate>;
+using u64   = Z<Unsigned,   64, Saturate>;
+using u128  = Z<Unsigned,  128, Saturate>;
+using u256  = Z<Unsigned,  256, Saturate>;
+using u512  = Z<Unsigned,  512, Saturate>;
+using u1024 = Z<Unsigned, 1024, Saturate>;
+using u2048 = Z<Unsigned, 2048, Saturate>;
+using u4096 = Z<Unsigned, 4096, Saturate>;
+
+using i8    = Z<Signed,    8, Saturate>;
+using i16   = Z<Signed,   16, Saturate>;
+using i32   = Z<Signed,   32, Saturate>;
+using i64   = Z<Signed,   64, Saturate>;
+using i128  = Z<Signed,  128, Saturate>;
+using i256  = Z<Signed,  256, Saturate>;
+using i512  = Z<Signed,  512, Saturate>;
+using i1024 = Z<Signed, 1024, Saturate>;
+using i2048 = Z<Signed, 2048, Saturate>;
+using i4096 = Z<Signed, 4096, Saturate>;
+
+}  // namespace sat
+
+namespace thrw
+{
+
+using u8    = Z<Unsigned,    8, Throw>;
+using u16   = Z<Unsigned,   16, Throw>;
+using u32   = Z<Unsigned,   32, Throw>;
+using u64   = Z<Unsigned,   64, Throw>;
+using u128  = Z<Unsigned,  128, Throw>;
+using u256  = Z<Unsigned,  256, Throw>;
+using u512  = Z<Unsigned,  512, Throw>;
+using u1024 = Z<Unsigned, 1024, Throw>;
+using u2048 = Z<Unsigned, 2048, Throw>;
+using u4096 = Z<Unsigned, 4096, Throw>;
+
+using i8    = Z<Signed,    8, Throw>;
+using i16   = Z<Signed,   16, Throw>;
+using i32   = Z<Signed,   32, Throw>;
+using i64   = Z<Signed,   64, Throw>;
+using i128  = Z<Signed,  128, Throw>;
+using i256  = Z<Signed,  256, Throw>;
+using i512  = Z<Signed,  512, Throw>;
+using i1024 = Z<Signed, 1024, Throw>;
+using i2048 = Z<Signed, 2048, Throw>;
+using i4096 = Z<Signed, 4096, Throw>;
+
+}  // namespace thrw
+
+namespace term
+{
+
+using u8    = Z<Unsigned,    8, Terminate>;
+using u16   = Z<Unsigned,   16, Terminate>;
+using u32   = Z<Unsigned,   32, Terminate>;
+using u64   = Z<Unsigned,   64, Terminate>;
+using u128  = Z<Unsigned,  128, Terminate>;
+using u256  = Z<Unsigned,  256, Terminate>;
+using u512  = Z<Unsigned,  512, Terminate>;
+using u1024 = Z<Unsigned, 1024, Terminate>;
+using u2048 = Z<Unsigned, 2048, Terminate>;
+using u4096 = Z<Unsigned, 4096, Terminate>;
+
+using i8    = Z<Signed,    8, Terminate>;
+using i16   = Z<Signed,   16, Terminate>;
+using i32   = Z<Signed,   32, Terminate>;
+using i64   = Z<Signed,   64, Terminate>;
+using i128  = Z<Signed,  128, Terminate>;
+using i256  = Z<Signed,  256, Terminate>;
+using i512  = Z<Signed,  512, Terminate>;
+using i1024 = Z<Signed, 1024, Terminate>;
+using i2048 = Z<Signed, 2048, Terminate>;
+using i4096 = Z<Signed, 4096, Terminate>;
+
+}  // namespace term
+
+template <class T>
+struct div_t
 {
-    using X = decltype(x);
-    using Y = decltype(y);
-    using R = std::common_type_t<X, Y>;
-    auto z = R{x} - R{y};
-    return z;
-}
+    T quot;
+    T rem;
+};
 
-template <SignTag S, unsigned N, Policy P, detail::StandardInteger I>
-constexpr
-inline
+template <class T>
 auto
-operator-(Z<S, N, P> const& x, I const& i) noexcept(P{} != Throw{})
-    -> std::common_type_t<decltype(x), decltype(i)>
+constexpr
+operator==(div_t<T> const& x, div_t<T> const& y) noexcept
 {
-    using X = decltype(x);
-    using R = std::common_type_t<X, I>;
-    return R{x} - R{i};
+    return x.quot == y.quot && x.rem == y.rem;
 }
 
-template <SignTag S, unsigned N, Policy P, detail::StandardInteger I>
-constexpr
-inline
+template <class T>
 auto
-operator-(I const& i, Z<S, N, P> const& y) noexcept(P{} != Throw{})
-    -> std::common_type_t<decltype(i), decltype(y)>
+constexpr
+operator!=(div_t<T> const& x, div_t<T> const& y) noexcept
 {
-    using Y = decltype(y);
-    using R = std::common_type_t<I, Y>;
-    return R{i} - R{y};
+    return !(x == y);
 }
 
-// abs
-
-template <unsigned N, Policy P>
-constexpr
-inline
-auto
-abs(Z<Signed, N, P> const& x)
+template <class T>
+std::ostream&
+operator<<(std::ostream& os, div_t<T> const& x)
 {
-    auto y = x >> std::numeric_limits<Z<Signed, N, P>>::digits;
-    return (x ^ y) - y;
+    return os << '{' << x.quot << ", " << x.rem << '}';
 }
 
-// countl_zero
+// divmod
 
-template <unsigned N, Policy P>
+// Returns {x / y, x % y} from a single division
+
+template <SignTag S, unsigned N>
 constexpr
 inline
-unsigned
-countl_zero(Z<Unsigned, N, P> const& x) noexcept
+auto
+divmod(Z<S, N, Wrap> const& x, Z<S, N, Wrap> const& y) noexcept
+    -> div_t<Z<S, N, Wrap>>
 {
+    using R = Z<S, N, Wrap>;
     if constexpr (N <= Nlimit)
     {
-        return std::countl_zero(x.rep_);
+        using I = R::rep;
+        // min / -1 overflows I, and traps on x86
+        if constexpr (S{} == Signed{})
+        {
+            if (I(y.rep_) == I(-1))
+                return {-x, R{}};
+        }
+        return {R{I(x.rep_)/I(y.rep_)}, R{I(x.rep_)%I(y.rep_)}};
+    }
+    else if constexpr (S{} == Unsigned{})
+    {
+        R r;
+        auto const q = x.divrem(y, r);
+        return {q, r};
     }
     else
     {
-        if (x.hi_)
-            return countl_zero(x.hi_);
-        return N/2 + countl_zero(x.lo_);
+        using RU = Z<Unsigned, N, Wrap>;
+
+        auto const [q, r] = divmod(RU{abs(x)}, RU{abs(y)});
+        // The quotient is negative when the signs differ, the remainder takes the sign of x
+        RU const tq{(x ^ y) >> (N-1)};
+        RU const tr{x >> (N-1)};
+        return {R{(q ^ tq) - tq}, R{(r ^ tr) - tr}};
     }
 }
 
-// countl_one
-
-template <unsigned N, Policy P>
+// When x / y overflows, the quotient is that of operator/ and the remainder is x - q*y
+template <SignTag S, unsigned N, Policy P>
 constexpr
 inline
-unsigned
-countl_one(Z<Unsigned, N, P> const& x) noexcept
+auto
+divmod(Z<S, N, P> const& x, Z<S, N, P> const& y) noexcept(P{} != Throw{})
+    -> div_t<Z<S, N, P>>
 {
-    return countl_zero(~x);
-}
-
-// countr_zero
+    using R  = Z<S, N, P>;
+    using RW = Z<S, N, Wrap>;
 
-template <unsigned N, Policy P>
-constexpr
-inline
-unsigned
-countr_zero(Z<Unsigned, N, P> const& x) noexcept
-{
-    if constexpr (N <= Nlimit)
-    {
-        return std::countr_zero(x.rep_);
-    }
-    else
+    bool overflows = y == R{};
+    if constexpr (S{} == Signed{})
+        overflows = overflows || (x == std::numeric_limits<R>::min() && y == R{-1});
+    if (overflows)
     {
-        if (x.lo_)
-            return countr_zero(x.lo_);
-        return N/2 + countr_zero(x.hi_);
+        auto const q = x / y;
+        return {q, R{RW{x} - RW{q}*RW{y}}};
     }
+    auto const [q, r] = divmod(RW{x}, RW{y});
+    return {R{q}, R{r}};
 }
 
-// countr_one
-
-template <unsigned N, Policy P>
+template <SignTag S1, unsigned N1, Policy P, SignTag S2, unsigned N2>
 constexpr
 inline
-unsigned
-countr_one(Z<Unsigned, N, P> const& x) noexcept
+auto
+divmod(Z<S1, N1, P> const& x, Z<S2, N2, P> const& y) noexcept(P{} != Throw{})
+    -> div_t<std::common_type_t<decltype(x), decltype(y)>>
 {
-    return countr_zero(~x);
+    using X = decltype(x);
+    using Y = decltype(y);
+    using R = std::common_type_t<X, Y>;
+    return divmod(R{x}, R{y});
 }
 
-// popcount
+// div_by / rem_by
 
-template <unsigned N, Policy P>
+// x / C and x % C for a constant C > 0.  The normalization shift and the reciprocal
+// of C are computed at compile time, so dividing by a C that fits in a limb costs
+// two multiplies per limb.  These never overflow.
+
+template <std::uint64_t C, SignTag S, unsigned N, Policy P>
+requires(C > 0)
 constexpr
 inline
-unsigned
-popcount(Z<Unsigned, N, P> const& x) noexcept
+Z<S, N, P>
+div_by(Z<S, N, P> const& x) noexcept
 {
-    if constexpr (N <= Nlimit)
-    {
-        return std::popcount(x.rep_);
-    }
-    else
-    {
-        return popcount(x.hi_) + popcount(x.lo_);
-    }
+    using RW = Z<S, N, Wrap>;
+    return Z<S, N, P>{detail::divmod_by<C>(RW{x}).quot};
 }
 
-// * Wrap
-
-namespace detail
-{
-
-template <unsigned N>
+template <std::uint64_t C, SignTag S, unsigned N, Policy P>
+requires(C > 0)
 constexpr
 inline
-Z<Unsigned, 2*N, Wrap>
-mul2(Z<Unsigned, N, Wrap> const& x, Z<Unsigned, N, Wrap> const& y) noexcept
+Z<S, N, P>
+rem_by(Z<S, N, P> const& x) noexcept
 {
-    using R2 = Z<Unsigned, 2*N, Wrap>;
-    if constexpr (N < Nlimit || N == 8)
-    {
-        using rep2 = std::tuple_element_t<std::countr_zero(2*N) - 3,
-                                          typename Z<Unsigned, 8, Wrap>::utypes>;
-        return R2{rep2{x.rep_}*rep2{y.rep_}};
-    }
-    else  // N >= Nlimit && N >= 16
-    {
-        using R = Z<Unsigned, N, Wrap>;
-        using Rhalf = Z<Unsigned, N/2, Wrap>;
-
-        R constexpr mask  = std::numeric_limits<Rhalf>::max();
+    using RW = Z<S, N, Wrap>;
+    return Z<S, N, P>{detail::divmod_by<C>(RW{x}).rem};
+}
 
-        auto x0 = Rhalf(x & mask);
-        auto x1 = Rhalf(x >> N/2);
-        auto y0 = Rhalf(y & mask);
-        auto y1 = Rhalf(y >> N/2);
+// divider
 
-        R t = mul2(x0, y0);
-        auto r2 = R2{t & mask};
-        R c = t >> N/2;
+// A divisor prepared for dividing many values by it.  The constructor normalizes
+// |d| and computes the reciprocal of its high limb once, so that quot, rem and
+// divmod estimate each quotient limb with multiplications instead of a hardware
+// division.  The results are those of x / d, x % d and divmod(x, d), including
+// the reporting of division by zero and overflow.
 
-        t = mul2(x1, y0) + c;
-        c = t >> N/2;
-        t &= mask;
+template <SignTag S, unsigned N, Policy P>
+class divider<Z<S, N, P>>
+{
+    using R  = Z<S, N, P>;
+    using RW = Z<S, N, Wrap>;
+    using RU = Z<Unsigned, N, Wrap>;
+    using limb_t = detail::limb_t;
 
-        t += mul2(x0, y1);
-        c += t >> N/2;
-        t &= mask;
-        r2 |= t << N/2;
+    static constexpr unsigned n = (N + detail::limb_bits - 1) / detail::limb_bits;
 
-        r2 |= R2{mul2(x1, y1) + c} << N;
-        return r2;
-    }
-}
+    R d_;
+    std::array<limb_t, n> v_{};  // |d| << s_
+    unsigned yn_{};              // significant limbs in v_, 0 if d_ can overflow
+    unsigned s_{};
+    limb_t vinv_{};              // reciprocal(v_[yn_-1])
 
-template <unsigned N>
-constexpr
-inline
-Z<Signed, 2*N, Wrap>
-mul2(Z<Signed, N, Wrap> const& x, Z<Signed, N, Wrap> const& y) noexcept
-{
-    using R2 = Z<Signed, 2*N, Wrap>;
-    if constexpr (N < Nlimit || N == 8)
-    {
-        using rep2 = std::tuple_element_t<std::countr_zero(2*N) - 3,
-                                          typename Z<Signed, 8, Wrap>::stypes>;
-        using rep = std::tuple_element_t<std::countr_zero(N) - 3,
-                                          typename Z<Signed, 8, Wrap>::stypes>;
-        return R2{rep2{rep(x.rep_)}*rep2{rep(y.rep_)}};
-    }
-    else  // N >= Nlimit && N >= 16
+public:
+    explicit constexpr divider(R const& d) noexcept
+        : d_{d}
     {
-        using RU = Z<Unsigned, N, Wrap>;
-        auto r2u = mul2(RU{x}, RU{y});
-        using R2U = decltype(r2u);
-        if (x.is_neg())
-            r2u -= R2U{y} << N;
-        if (y.is_neg())
-            r2u -= R2U{x} << N;
-        return R2{r2u};
+        if (d == R{})
+            return;
+        RU u;
+        if constexpr (S{} == Signed{})
+        {
+            // Only trapping policies have to see min / -1
+            if constexpr (P{} != Wrap{})
+                if (d == R{-1})
+                    return;
+            u = RU{abs(RW{d})};
+        }
+        else
+            u = RU{d};
+        if constexpr (N <= Nlimit)
+        {
+            for (unsigned j = 0; j < n; ++j)
+                v_[j] = limb_t(u.rep_ >> j*detail::limb_bits);
+        }
+        else
+            v_ = u.limbs_;
+        yn_ = n;
+        while (v_[yn_-1] == 0)
+            --yn_;
+        s_ = unsigned(std::countl_zero(v_[yn_-1]));
+        if (s_ != 0)
+            detail::lshift_n(v_.data(), v_.data(), yn_, s_);
+        vinv_ = detail::reciprocal(v_[yn_-1]);
     }
-}
 
-}  // namespace detail
-
-template <SignTag S, unsigned N>
-constexpr
-inline
-auto
-operator*(Z<S, N, Wrap> const& x, Z<S, N, Wrap> const& y) noexcept
-    -> Z<S, N, Wrap>
-{
-    using R = Z<S, N, Wrap>;
-    return R{detail::mul2(x, y)};
-}
-
-// * Saturate
-
-template <SignTag S, unsigned N>
-constexpr
-inline
-auto
-operator*(Z<S, N, Saturate> const& x, Z<S, N, Saturate> const& y) noexcept
-    -> Z<S, N, Saturate>
-{
-    using R = Z<S, N, Saturate>;
-    using RW = Z<S, N, Wrap>;
-    return R{detail::mul2(RW{x}, RW{y})};
-}
+    constexpr R divisor() const noexcept {return d_;}
 
-// * Throw / Terminate
+    constexpr R quot(R const& x) const noexcept(P{} != Throw{}) {return divmod(x).quot;}
+    constexpr R rem(R const& x) const noexcept(P{} != Throw{}) {return divmod(x).rem;}
 
-template <unsigned N, ErrorCheckedPolicy P>
-constexpr
-inline
-auto
-operator*(Z<Unsigned, N, P> const& x, Z<Unsigned, N, P> const& y)
-    noexcept(P{} == Terminate{})
-    -> Z<Unsigned, N, P>
-{
-    using R = Z<Unsigned, N, P>;
-    using RW = Z<Unsigned, N, Wrap>;
-    auto r2 = detail::mul2(RW{x}, RW{y});
-    R hi{RW{r2 >> N}};
-    R lo{RW{r2}};
-    if (hi)
+    constexpr div_t<R> divmod(R const& x) const noexcept(P{} != Throw{})
     {
-        auto const msg = to_string<R>() + '{' + to_string(x) + "} * " +
-                         to_string<R>() + '{' + to_string(y) + "} overflowed";
-        if constexpr (P{} == Throw{})
-            throw std::overflow_error(msg);
+        if (yn_ == 0)
+            return bbi::divmod(x, d_);
+        if constexpr (S{} == Unsigned{})
+        {
+            auto const [q, r] = divmod_abs(RU{x});
+            return {R{q}, R{r}};
+        }
         else
         {
-            std::cerr << msg << '\n';
-            std::terminate();
+            auto const [q, r] = divmod_abs(RU{abs(RW{x})});
+            // The quotient is negative when the signs differ, the remainder takes the sign of x
+            RU const tq{(RW{x} ^ RW{d_}) >> (N-1)};
+            RU const tr{RW{x} >> (N-1)};
+            return {R{RW{(q ^ tq) - tq}}, R{RW{(r ^ tr) - tr}}};
         }
     }
-    return lo;
-}
 
-template <unsigned N, ErrorCheckedPolicy P>
-constexpr
-inline
-auto
-operator*(Z<Signed, N, P> const& x, Z<Signed, N, P> const& y) noexcept(P{} == Terminate{})
-    -> Z<Signed, N, P>
-{
-    using R = Z<Signed, N, P>;
-    using RW = Z<Signed, N, Wrap>;
-    auto r2 = detail::mul2(RW{x}, RW{y});
-    R hi{RW{r2 >> N}};
-    R lo{RW{r2}};
-    if (hi != (lo >> (N-1)))
+private:
+    constexpr div_t<RU> divmod_abs(RU const& x) const noexcept
     {
-        auto const msg = to_string<R>() + '{' + to_string(x) + ") * " +
-                         to_string<R>() + '{' + to_string(y) + ") overflowed";
-        if constexpr (P{} == Throw{})
-            throw std::overflow_error(msg);
-        else
+        RU q;
+        RU r;
+        if constexpr (n == 1)
         {
-            std::cerr << msg << '\n';
-            std::terminate();
+            // x is a single limb:  divide x << s_ by v_[0]
+            auto const x0 = limb_t(x.rep_);
+            auto const x1 = limb_t(x0 >> 1 >> (detail::limb_bits - 1 - s_));
+            limb_t r0;
+            q = RU{detail::div_limb_preinv(x1, limb_t(x0 << s_), v_[0], vinv_, r0)};
+            r = RU{limb_t(r0 >> s_)};
+        }
+        else if constexpr (N <= Nlimit)
+        {
+            // A native integer wider than a limb
+            using rep = RU::rep;
+            std::array<limb_t, n> a;
+            std::array<limb_t, n> qa;
+            std::array<limb_t, n> ra;
+            for (unsigned j = 0; j < n; ++j)
+                a[j] = limb_t(x.rep_ >> j*detail::limb_bits);
+            detail::divrem_preinv<n>(qa.data(), ra.data(), a.data(), v_.data(), yn_, s_, vinv_);
+            rep qr{};
+            rep rr{};
+            for (unsigned j = n; j-- > 0;)
+            {
+                qr = rep(qr << detail::limb_bits) | qa[j];
+                rr = rep(rr << detail::limb_bits) | ra[j];
+            }
+            q = RU{qr};
+            r = RU{rr};
         }
+        else
+            detail::divrem_preinv<n>(q.limbs_.data(), r.limbs_.data(), x.limbs_.data(),
+                                     v_.data(), yn_, s_, vinv_);
+        return {q, r};
     }
-    return lo;
-}
+};
 
-template <SignTag S1, unsigned N1, Policy P, SignTag S2, unsigned N2>
+
+namespace detail
+{
+
+// r[0, n) = t[0, 2n) / B^n modulo m[0, n) by Montgomery's REDC, for odd m,
+// t < m B^n and minv == -1/m[0] modulo B.  t is overwritten.  r < m, and the
+// final subtraction of m is done with a mask, not a branch.
+template <unsigned n>
 constexpr
-inline
-auto
-operator*(Z<S1, N1, P> const& x, Z<S2, N2, P> const& y) noexcept(P{} != Throw{})
-    -> std::common_type_t<decltype(x), decltype(y)>
+void
+mont_redc(limb_t* r, limb_t* t, limb_t const* m, limb_t minv) noexcept
 {
-    using X = decltype(x);
-    using Y = decltype(y);
-    using R = std::common_type_t<X, Y>;
-    auto z = R{x} * R{y};
-    return z;
+    limb_t c{};
+    for (unsigned i = 0; i < n; ++i)
+    {
+        // Adding u m makes t[i] zero
+        auto const u = limb_t(std::uint64_t{t[i]} * minv);
+        auto const hi = addmul_1(t+i, m, n, u);
+        t[i+n] = addc(t[i+n], hi, c);
+    }
+    // c B^n + t[n, 2n) < 2m
+    std::array<limb_t, n> d;
+    auto const b = sub_n(d.data(), t+n, m, n);
+    auto const keep = limb_t(0 - limb_t(c < b));
+    for (unsigned j = 0; j < n; ++j)
+        r[j] = limb_t((t[n+j] & keep) | (d[j] & ~keep));
 }
 
-template <SignTag S, unsigned N, Policy P, detail::StandardInteger I>
+// r[0, n) = x[0, n) * y[0, n) / B^n modulo m[0, n).  If x and y are the same
+// pointer, the product is computed as a square.
+template <unsigned n>
 constexpr
-inline
-auto
-operator*(Z<S, N, P> const& x, I const& i) noexcept(P{} != Throw{})
-    -> std::common_type_t<decltype(x), decltype(i)>
+void
+mont_mul(limb_t* r, limb_t const* x, limb_t const* y, limb_t const* m, limb_t minv) noexcept
 {
-    using X = decltype(x);
-    using R = std::common_type_t<X, I>;
-    return R{x} * R{i};
+    std::array<limb_t, 2*n> t;
+    mul_n<n>(t.data(), x, y);
+    mont_redc<n>(r, t.data(), m, minv);
 }
 
-template <SignTag S, unsigned N, Policy P, detail::StandardInteger I>
+// As mont_mul, but always by the basecase over all n limbs, for secret x and y.
+// Karatsuba and Toom-3 branch on the values of their operands in abs_sub, while the
+// sequence of operations of the basecase depends only on n.
+template <unsigned n>
 constexpr
-inline
-auto
-operator*(I const& i, Z<S, N, P> const& y) noexcept(P{} != Throw{})
-    -> std::common_type_t<decltype(i), decltype(y)>
+void
+mont_mul_sec(limb_t* r, limb_t const* x, limb_t const* y, limb_t const* m,
+             limb_t minv) noexcept
 {
-    return y * i;
+    std::array<limb_t, 2*n> t;
+    if (x == y)
+        sqr_basecase(t.data(), x, n);
+    else
+        mul_basecase(t.data(), x, n, y, n);
+    mont_redc<n>(r, t.data(), m, minv);
 }
 
-// /
-
-template <unsigned N>
+// The window width for exponentiation by an exponent of ebits bits
 constexpr
 inline
-auto
-operator/(Z<Unsigned, N, Wrap> const& x, Z<Unsigned, N, Wrap> const& y) noexcept
-    -> Z<Unsigned, N, Wrap>
-{
-    using R = Z<Unsigned, N, Wrap>;
-    if constexpr (N <= Nlimit)
+unsigned
+pow_window_bits(unsigned ebits) noexcept
+{
+    return ebits > 671 ? 6 : ebits > 239 ? 5 : ebits > 79 ? 4 : ebits > 23 ? 3 : 1;
+}
+
+// x^e by left to right sliding windows, where e[0, en) holds the limbs of e, one
+// is x^0 and mul(a, b) is the product.  With windows of k bits the odd powers x,
+// x^3, ..., x^(2^k-1) are computed first, and then every window of at most k bits
+// that starts and ends with a 1 costs a single multiplication.  The squarings
+// pass the same object as both arguments of mul.
+template <class T, class Mul>
+constexpr
+T
+pow_sliding(T const& x, limb_t const* e, unsigned en, T const& one, Mul mul)
+{
+    auto const bit = [e](unsigned i) {return (e[i / limb_bits] >> i % limb_bits) & 1;};
+    // The bits of e left to do are e[0, i)
+    unsigned i = en * limb_bits;
+    while (i > 0 && bit(i-1) == 0)
+        --i;
+    if (i == 0)
+        return one;
+    unsigned const k = pow_window_bits(i);
+    std::array<T, 32> t;  // t[j] == x^(2j+1)
+    t[0] = x;
+    if (k > 1)
     {
-        return R{x.rep_ / y.rep_};
+        auto const x2 = mul(x, x);
+        for (unsigned j = 1; j < 1u << (k-1); ++j)
+            t[j] = mul(t[j-1], x2);
     }
-    else
+    auto r = one;
+    bool first = true;
+    while (i > 0)
     {
-        using R2 = Z<Unsigned, N/2, Wrap>;
-
-        auto constexpr divlu = [](R x, R2 y) noexcept -> R2
+        if (bit(i-1) == 0)
+        {
+            r = mul(r, r);
+            --i;
+            continue;
+        }
+        // The window e[l, i) ends in a 1
+        auto l = i > k ? i - k : 0;
+        while (bit(l) == 0)
+            ++l;
+        unsigned w = 0;
+        for (auto j = i; j-- > l;)
+            w = 2*w + unsigned(bit(j));
+        if (first)
+            r = t[w / 2];
+        else
         {
-            constexpr R2 b = R2{1} << N/4;
-            R2 constexpr mask = std::numeric_limits<R2>::max() >> N/4;
-            auto s = countl_zero(y);
-            y <<= s;
-            R2 yn0 = y & mask;
-            R2 yn1 = y >> N/4;
+            for (auto j = l; j < i; ++j)
+                r = mul(r, r);
+            r = mul(r, t[w / 2]);
+        }
+        first = false;
+        i = l;
+    }
+    return r;
+}
 
-            x <<= s;
-            R2 xn10(x);
-            R2 xn32(x >> N/2);
+}  // namespace detail
 
-            R2 xn1 = xn10 >> N/4;
-            R2 xn0 = xn10 & mask;
+// montgomery
 
-            R2 q1 = xn32 / yn1;
-            R2 rhat = xn32 - q1*yn1;
+// Arithmetic modulo a fixed odd m in Montgomery form.  With R == B^n, where B is
+// the limb base and n the number of limbs of Z, a residue x is held as x R modulo
+// m in a montgomery<Z>::value.  The product of two of them is then
+// (x R)(y R) / R modulo m, which takes one multiplication and one reduction by
+// multiplications (REDC), instead of a division.  The constructor computes
+// -1/m modulo B and R^2 modulo m once, and to_mont and from_mont convert to and
+// from the Montgomery form.  A value refers to the montgomery that made it, which
+// must outlive it, and values of different montgomery objects don't mix.
+//
+// m must be odd.  The Throw and Terminate policies report an even m, and with
+// the other policies the results for an even m are unspecified.
 
-            auto adjust_hi = [&]()
-                {
-                    if (q1 >= b || q1*yn0 > (rhat << N/4) + xn1)
-                    {
-                        --q1;
-                        rhat += yn1;
-                        if (rhat < b)
-                            return true;
-                    }
-                    return false;
-                };
-            do {} while (adjust_hi());
+template <unsigned N, Policy P>
+class montgomery<Z<Unsigned, N, P>>
+{
+    using R  = Z<Unsigned, N, P>;
+    using RU = Z<Unsigned, N, Wrap>;
+    using limb_t = detail::limb_t;
 
-            R2 xn21 = (xn32 << N/4) + xn1 - q1*y;
+    static constexpr unsigned n = (N + detail::limb_bits - 1) / detail::limb_bits;
+    using limbs = std::array<limb_t, n>;
 
-            R2 q0 = xn21 / yn1;
-            rhat = xn21 - q0*yn1;
+    limbs m_{};
+    limbs r2_{};     // R^2 modulo m
+    limb_t minv_{};  // -1/m modulo B
 
-            auto adjust_lo = [&]()
-                {
-                    if (q0 >= b || q0*yn0 > (rhat << N/4) + xn0)
-                    {
-                        --q0;
-                        rhat += yn1;
-                        if (rhat < b)
-                            return true;
-                    }
-                    return false;
-                };
-            do {} while (adjust_lo());
+public:
+    class value
+    {
+        montgomery const* ctx_ = nullptr;
+        limbs v_{};  // x R modulo m
 
-            return (q1 << N/4) + q0;
-        };
-        if (!(y >> N/2))
+        friend class montgomery;
+
+        constexpr value(montgomery const* ctx, limbs const& v) noexcept
+            : ctx_{ctx}
+            , v_{v}
+            {}
+
+        constexpr limb_t const* m() const noexcept {return ctx_->m_.data();}
+        constexpr limb_t minv() const noexcept {return ctx_->minv_;}
+
+    public:
+        value() = default;
+
+        friend
+        constexpr
+        value
+        operator*(value const& x, value const& y) noexcept
         {
-            if ((x >> N/2) < y)
-                return divlu(x, R2(y));
-            else
+            value r{x.ctx_, {}};
+            detail::mont_mul<n>(r.v_.data(), x.v_.data(), y.v_.data(), x.m(), x.minv());
+            return r;
+        }
+
+        friend
+        constexpr
+        value
+        operator+(value const& x, value const& y) noexcept
+        {
+            value r{x.ctx_, {}};
+            auto const c = detail::add_n(r.v_.data(), x.v_.data(), y.v_.data(), n);
+            limbs d;
+            auto const b = detail::sub_n(d.data(), r.v_.data(), x.m(), n);
+            if (c >= b)
+                r.v_ = d;
+            return r;
+        }
+
+        friend
+        constexpr
+        value
+        operator-(value const& x, value const& y) noexcept
+        {
+            value r{x.ctx_, {}};
+            if (detail::sub_n(r.v_.data(), x.v_.data(), y.v_.data(), n))
+                detail::add_n(r.v_.data(), r.v_.data(), x.m(), n);
+            return r;
+        }
+
+        friend
+        constexpr
+        value
+        operator-(value const& x) noexcept
+        {
+            return value{x.ctx_, {}} - x;
+        }
+
+        constexpr value& operator*=(value const& y) noexcept {return *this = *this * y;}
+        constexpr value& operator+=(value const& y) noexcept {return *this = *this + y;}
+        constexpr value& operator-=(value const& y) noexcept {return *this = *this - y;}
+
+        friend
+        constexpr
+        bool
+        operator==(value const& x, value const& y) noexcept
+        {
+            return x.v_ == y.v_;
+        }
+
+        friend
+        constexpr
+        bool
+        operator!=(value const& x, value const& y) noexcept
+        {
+            return !(x == y);
+        }
+    };
+
+    explicit constexpr montgomery(R const& m) noexcept(P{} != Throw{})
+        : m_{detail::to_limbs(RU{m})}
+    {
+        if ((m_[0] & 1) == 0)
+        {
+            if constexpr (ErrorCheckedPolicy<P>)
             {
-                R2 x1(x >> N/2);
-                R2 x0(x);
-                R2 y0(y);
-                R2 q1 = divlu(x1, y0);
-                auto k = x1 - q1*y;
-                R2 q0 = divlu((k << N/2) + x0, y0);
-                return (R(q1) << N/2) | R(q0);
+                auto const msg = to_string<R>() + '{' + to_string(m) + "} is not an odd modulus";
+                if constexpr (P{} == Throw{})
+                    throw std::domain_error(msg);
+                else
+                {
+                    std::cerr << msg << '\n';
+                    std::terminate();
+                }
             }
+            // Otherwise the results are unspecified
+            return;
         }
+        // Newton's iteration doubles the correct low bits of 1/m, and m*m == 1 modulo 8
+        std::uint64_t const m0 = m_[0];
+        std::uint64_t inv = m0;
+        for (int i = 0; i < 5; ++i)
+            inv *= 2 - m0*inv;
+        minv_ = limb_t(0 - inv);
+        // R^2 modulo m, as B^2n % m
+        unsigned yn = n;
+        while (yn > 1 && m_[yn-1] == 0)
+            --yn;
+        auto const s = unsigned(std::countl_zero(m_[yn-1]));
+        limbs v = m_;
+        if (s != 0)
+            detail::lshift_n(v.data(), v.data(), yn, s);
+        std::array<limb_t, 2*n+1> x{};
+        x[2*n] = 1;
+        std::array<limb_t, 2*n+1> q;
+        std::array<limb_t, 2*n+1> r;
+        detail::divrem_preinv<2*n+1>(q.data(), r.data(), x.data(), v.data(), yn, s,
+                                     detail::reciprocal(v[yn-1]));
+        std::copy(r.begin(), r.begin() + n, r2_.begin());
+    }
 
-        auto n = countl_zero(y);
-        R2 y1 = R2((y << n) >> N/2);
-        R x1 = x >> 1;
-        R q1 = divlu(x1, y1);
-        R q = (q1 << n) >> (N/2-1);
-        if (q)
-            --q;
-        if ((x - q*y) >= y)
-            ++q;
-        return q;
+    constexpr R modulus() const noexcept {return R{detail::from_limbs<N>(m_.data())};}
+
+    // x R modulo m.  x may be secret (see pow_sec).
+    constexpr value to_mont(R const& x) const noexcept
+    {
+        // x < B^n and R^2 % m < m, so REDC applies without first reducing x
+        value r{this, detail::to_limbs(RU{x})};
+        detail::mont_mul_sec<n>(r.v_.data(), r.v_.data(), r2_.data(), m_.data(), minv_);
+        return r;
     }
-}
 
-template <unsigned N>
-constexpr
-inline
-auto
-operator/(Z<Unsigned, N, Saturate> const& x,
-          Z<Unsigned, N, Saturate> const& y) noexcept
-    -> Z<Unsigned, N, Saturate>
-{
-    using R  = Z<Unsigned, N, Saturate>;
-    using RW = Z<Unsigned, N, Wrap>;
+    // x modulo m, from its Montgomery form
+    constexpr R from_mont(value const& x) const noexcept
+    {
+        std::array<limb_t, 2*n> t{};
+        std::copy(x.v_.begin(), x.v_.end(), t.begin());
+        limbs r;
+        detail::mont_redc<n>(r.data(), t.data(), m_.data(), minv_);
+        return R{detail::from_limbs<N>(r.data())};
+    }
 
-    if (!y)
-        return std::numeric_limits<R>::max();
-    return R{RW{x}/RW{y}};
-}
+    // 1 in Montgomery form, R modulo m
+    constexpr value one() const noexcept {return to_mont(R{1});}
 
-template <unsigned N, ErrorCheckedPolicy P>
-constexpr
-inline
-auto
-operator/(Z<Unsigned, N, P> const& x, Z<Unsigned, N, P> const& y)
-    noexcept(P{} == Terminate{})
-    -> Z<Unsigned, N, P>
-{
-    using R  = Z<Unsigned, N, P>;
-    using RW = Z<Unsigned, N, Wrap>;
+    // x^e by sliding windows
+    template <unsigned Ne, Policy Pe>
+    constexpr value pow(value const& x, Z<Unsigned, Ne, Pe> const& e) const noexcept
+    {
+        auto const el = detail::to_limbs(Z<Unsigned, Ne, Wrap>{e});
+        return detail::pow_sliding(x, el.data(), unsigned(el.size()), one(),
+                                   [](value const& a, value const& b) {return a * b;});
+    }
 
-    if (!y)
+    // x^e for a secret x and e, with m public.  The sequence of operations and of
+    // memory accesses depends only on N and Ne:  fixed windows cover all Ne bits of
+    // e, every window multiplies, even by x^0, each table lookup reads every entry,
+    // and every product is by mont_mul_sec.
+    template <unsigned Ne, Policy Pe>
+    constexpr value pow_sec(value const& x, Z<Unsigned, Ne, Pe> const& e) const noexcept
     {
-        auto const msg = to_string<R>() + '{' + to_string(x) + "} / 0";
-        if constexpr (P{} == Throw{})
-            throw std::overflow_error(msg);
-        else
+        auto const mul = [this](value const& a, value const& b)
         {
-            std::cerr << msg << '\n';
-            std::terminate();
+            value r{this, {}};
+            detail::mont_mul_sec<n>(r.v_.data(), a.v_.data(), b.v_.data(), m_.data(), minv_);
+            return r;
+        };
+        auto const el = detail::to_limbs(Z<Unsigned, Ne, Wrap>{e});
+        unsigned constexpr k = detail::pow_window_bits(Ne) < 4 ? 4 : detail::pow_window_bits(Ne);
+        std::array<value, 1u << k> t;  // t[j] == x^j
+        t[0] = one();
+        for (unsigned j = 1; j < t.size(); ++j)
+            t[j] = mul(t[j-1], x);
+        auto const window = [&el](unsigned l, unsigned len)
+        {
+            unsigned w = 0;
+            for (auto j = l + len; j-- > l;)
+                w = 2*w + unsigned((el[j / detail::limb_bits] >> j % detail::limb_bits) & 1);
+            return w;
+        };
+        auto const select = [this, &t](unsigned w)
+        {
+            value r{this, {}};
+            for (unsigned j = 0; j < t.size(); ++j)
+            {
+                auto const mask = limb_t(0 - limb_t(j == w));
+                for (unsigned i = 0; i < n; ++i)
+                    r.v_[i] |= t[j].v_[i] & mask;
+            }
+            return r;
+        };
+        unsigned i = Ne - (Ne % k == 0 ? k : Ne % k);
+        auto r = select(window(i, Ne - i));
+        while (i > 0)
+        {
+            i -= k;
+            for (unsigned j = 0; j < k; ++j)
+                r = mul(r, r);
+            r = mul(r, select(window(i, k)));
         }
+        return r;
     }
-    return R{RW{x}/RW{y}};
-}
+};
 
-template <unsigned N>
-constexpr
-inline
-auto
-operator/(Z<Signed, N, Wrap> const& x, Z<Signed, N, Wrap> const& y) noexcept
-    -> Z<Signed, N, Wrap>
+// barrett
+
+// Reduction modulo a fixed m by Barrett's method (HAC 14.42), for any m > 0.  With
+// B the limb base and k the number of significant limbs of m, the constructor
+// computes mu == B^2k / m once.  Then a value t < B^2k is reduced with two
+// multiplications:  q == (t / B^(k-1)) * mu / B^(k+1) is at most 2 less than t / m,
+// so t - q*m needs at most two corrections.  Longer values are reduced k limbs at
+// a time.  For an m of full width the multiplications are those of n+1 limbs,
+// with Karatsuba and Toom-3 as usual.
+//
+// reduce and mul by an m == 0 report the division by zero as x % 0 does.
+
+template <unsigned N, Policy P>
+class barrett<Z<Unsigned, N, P>>
 {
-    using R  = Z<Signed, N, Wrap>;
+    using R  = Z<Unsigned, N, P>;
+    using RU = Z<Unsigned, N, Wrap>;
+    using W  = Z<Unsigned, 2*N, Wrap>;
+    using limb_t = detail::limb_t;
 
-    if constexpr (N <= Nlimit)
+    static constexpr unsigned n = (N + detail::limb_bits - 1) / detail::limb_bits;
+
+    std::array<limb_t, n+1> m_{};
+    std::array<limb_t, n+1> mu_{};  // B^2k / m, less B^(k+1) if mu_hi_
+    bool mu_hi_{};                  // m == B^(k-1), and B^2k / m == B^(k+1)
+    unsigned k_{};                  // significant limbs in m, 0 if m == 0
+
+public:
+    explicit constexpr barrett(R const& m) noexcept
     {
-        using I = R::rep;
-        return R{I(x.rep_)/I(y.rep_)};
+        auto const ml = detail::to_limbs(RU{m});
+        std::copy(ml.begin(), ml.end(), m_.begin());
+        k_ = n;
+        while (k_ > 0 && m_[k_-1] == 0)
+            --k_;
+        if (k_ == 0)
+            return;
+        auto const s = unsigned(std::countl_zero(m_[k_-1]));
+        std::array<limb_t, n> v;
+        std::copy(ml.begin(), ml.end(), v.begin());
+        if (s != 0)
+            detail::lshift_n(v.data(), v.data(), k_, s);
+        std::array<limb_t, 2*n+1> x{};
+        x[2*k_] = 1;
+        std::array<limb_t, 2*n+1> q;
+        std::array<limb_t, 2*n+1> r;
+        detail::divrem_preinv<2*n+1>(q.data(), r.data(), x.data(), v.data(), k_, s,
+                                     detail::reciprocal(v[k_-1]));
+        std::copy(q.begin(), q.begin() + (k_+1), mu_.begin());
+        mu_hi_ = q[k_+1] != 0;
     }
-    else
-    {
-        using RU = Z<Unsigned, N, Wrap>;
 
-        RU xu{abs(x)};
-        RU yu{abs(y)};
-        auto q = xu / yu;
-        RU t{(x ^ y) >> (N-1)};
-        return R{(q ^ t) - t};
-    }
-}
+    constexpr R modulus() const noexcept {return R{detail::from_limbs<N>(m_.data())};}
 
-template <unsigned N>
-constexpr
-inline
-auto
-operator/(Z<Signed, N, Saturate> const& x, Z<Signed, N, Saturate> const& y) noexcept
-    -> Z<Signed, N, Saturate>
-{
-    using R  = Z<Signed, N, Saturate>;
-    using RS = Z<Signed, N, Wrap>;
+    // x % m
+    constexpr R reduce(W const& x) const noexcept(P{} != Throw{})
+    {
+        if (k_ == 0)
+            return R{Z<Unsigned, 2*N, P>{x} % Z<Unsigned, 2*N, P>{}};
+        auto const xl = detail::to_limbs(x);
+        return reduce(xl.data(), unsigned(xl.size()));
+    }
 
-    auto constexpr m = std::numeric_limits<R>::min();
-    auto constexpr M = std::numeric_limits<R>::max();
-    auto constexpr n_one = R{-1};
-    if (!y)
+    // x * y % m
+    constexpr R mul(R const& x, R const& y) const noexcept(P{} != Throw{})
     {
-        if (x >= R{})
-            return M;
-        return m;
+        if (k_ == 0)
+            return reduce(W{x} * W{y});
+        auto const xl = detail::to_limbs(RU{x});
+        auto const yl = detail::to_limbs(RU{y});
+        std::array<limb_t, 2*n> p;
+        detail::mul_n<n>(p.data(), xl.data(), yl.data());
+        return reduce(p.data(), 2*n);
     }
-    if (x == m && y == n_one)
-        return M;
-    return R{RS{x}/RS{y}};
-}
 
-template <unsigned N, ErrorCheckedPolicy P>
-constexpr
-inline
-auto
-operator/(Z<Signed, N, P> const& x, Z<Signed, N, P> const& y) noexcept(P{} == Terminate{})
-    -> Z<Signed, N, P>
-{
-    using R  = Z<Signed, N, P>;
-    using RS = Z<Signed, N, Wrap>;
+private:
+    constexpr R reduce(limb_t const* x, unsigned xn) const noexcept
+    {
+        auto const k = k_;
+        while (xn > 0 && x[xn-1] == 0)
+            --xn;
+        // t < B^2k is reduced into its low k limbs
+        std::array<limb_t, 2*n> t{};
+        if (xn <= 2*k)
+        {
+            std::copy(x, x + xn, t.begin());
+            step(t.data());
+            return R{detail::from_limbs<N>(t.data())};
+        }
+        auto j = xn - 2*k;
+        std::copy(x + j, x + xn, t.begin());
+        step(t.data());
+        while (j > 0)
+        {
+            // t = t * B^c + x[j-c, j) < m B^k
+            auto const c = std::min(k, j);
+            j -= c;
+            for (auto i = k; i-- > 0;)
+                t[i+c] = t[i];
+            for (unsigned i = 0; i < c; ++i)
+                t[i] = x[j+i];
+            step(t.data());
+        }
+        return R{detail::from_limbs<N>(t.data())};
+    }
 
-    if (!y)
+    // t[0, k) = t[0, 2k) % m and t[k, 2k) = 0
+    constexpr void step(limb_t* t) const noexcept
     {
-        auto const msg = to_string<R>() + '{' + to_string(x) + "} / 0";
-        if constexpr (P{} == Throw{})
-            throw std::overflow_error(msg);
+        auto const k = k_;
+        // q2 = (t / B^(k-1)) * mu
+        std::array<limb_t, 2*n+2> q2;
+        std::array<limb_t, n+1> q1{};
+        std::copy(t + (k-1), t + 2*k, q1.begin());
+        if (k == n)
+            detail::mul_n<n+1>(q2.data(), q1.data(), mu_.data());
+        else
+            detail::mul_basecase(q2.data(), q1.data(), k+1, mu_.data(), k+1);
+        if (mu_hi_)
+            detail::add_n(q2.data() + (k+1), q2.data() + (k+1), q1.data(), k+1);
+        // r = t - q3 m modulo B^(k+1), with q3 = q2 / B^(k+1)
+        auto const q3 = q2.data() + (k+1);
+        std::array<limb_t, n+1> r2;
+        if (k == n)
+            detail::mullo_n<n+1>(r2.data(), q3, m_.data());
         else
         {
-            std::cerr << msg << '\n';
-            std::terminate();
+            std::fill(r2.begin(), r2.begin() + (k+1), 0);
+            for (unsigned i = 0; i <= k; ++i)
+                detail::addmul_1(r2.data() + i, m_.data(), k+1-i, q3[i]);
         }
+        detail::sub_n(t, t, r2.data(), k+1);
+        while (detail::cmp_n(t, m_.data(), k+1) >= 0)
+            detail::sub_n(t, t, m_.data(), k+1);
+        std::fill(t + k, t + 2*k, 0);
     }
-    auto constexpr m = std::numeric_limits<R>::min();
-    auto constexpr n_one = R{-1};
-    if (x == m && y == n_one)
+};
+
+namespace detail
+{
+
+// x * y modulo 2^N, in time linear in the significant limbs of x
+template <unsigned N>
+constexpr
+Z<Unsigned, N, Wrap>
+mul_u64(Z<Unsigned, N, Wrap> const& x, std::uint64_t y) noexcept
+{
+    if constexpr (N <= Nlimit)
+        return x * Z<Unsigned, N, Wrap>{y};
+    else
     {
-        auto const msg = to_string<R>() + '{' + to_string(x) + "} / "
-                       + to_string<R>() + '{' + to_string(y) + "} overflowed";
-        if constexpr (P{} == Throw{})
-            throw std::overflow_error(msg);
-        else
+        unsigned constexpr n = N / limb_bits;
+        auto const a = to_limbs(x);
+        unsigned xn = n;
+        while (xn > 0 && a[xn-1] == 0)
+            --xn;
+        std::array<limb_t, n> r{};
+        for (unsigned i = 0; i < 64 / limb_bits && i < n; ++i)
         {
-            std::cerr << msg << '\n';
-            std::terminate();
+            auto const yi = limb_t(y >> i*limb_bits);
+            if (yi != 0)
+            {
+                // r[i + xn, n) is still zero
+                auto const m = std::min(xn, n - i);
+                auto const c = addmul_1(r.data() + i, a.data(), m, yi);
+                if (i + m < n)
+                    r[i + m] = c;
+            }
         }
+        return from_limbs<N>(r.data());
     }
-    return R{RS{x}/RS{y}};
 }
 
-template <SignTag S1, unsigned N1, Policy P, SignTag S2, unsigned N2>
-constexpr
-inline
-auto
-operator/(Z<S1, N1, P> const& x, Z<S2, N2, P> const& y) noexcept(P{} != Throw{})
-    -> std::common_type_t<decltype(x), decltype(y)>
+}  // namespace detail
+
+// 10^k for k <= digits10 of T
+template <detail::isZ T>
+std::array<T, std::numeric_limits<T>::digits10 + 1> constexpr pow10_table = []
 {
-    using X = decltype(x);
-    using Y = decltype(y);
-    using R = std::common_type_t<X, Y>;
-    auto z = R{x} / R{y};
-    return z;
-}
+    using RU = Z<Unsigned, T::size, Wrap>;
+    std::array<T, std::numeric_limits<T>::digits10 + 1> p;
+    RU x{1};
+    for (auto& e : p)
+    {
+        e = T{x};
+        x = detail::mul_u64(x, 10);
+    }
+    return p;
+}();
 
-template <SignTag S, unsigned N, Policy P, detail::StandardInteger I>
+namespace detail
+{
+
+// Text conversion
+
+// The digits of bases 2 through 36
+inline char constexpr digit_chars[] = "0123456789abcdefghijklmnopqrstuvwxyz";
+
+// The largest power of b that fits in a limb, b^k
 constexpr
 inline
-auto
-operator/(Z<S, N, P> const& x, I const& i) noexcept(P{} != Throw{})
-    -> std::common_type_t<decltype(x), decltype(i)>
-{
-    using X = decltype(x);
-    using R = std::common_type_t<X, I>;
-    return R{x} / R{i};
+limb_t
+limb_chunk(unsigned b, unsigned& k) noexcept
+{
+    limb_t c = limb_t(b);
+    for (k = 1; c <= limb_t(~limb_t{}) / b; ++k)
+        c = limb_t(c * b);
+    return c;
+}
+
+// dec_chunk is the largest power of 10 that fits in a limb
+unsigned constexpr dec_chunk_digits = limb_bits == 8  ? 2 :
+                                      limb_bits == 16 ? 4 :
+                                      limb_bits == 32 ? 9 : 19;
+limb_t constexpr dec_chunk = []
+{
+    limb_t p = 1;
+    for (unsigned i = 0; i < dec_chunk_digits; ++i)
+        p = limb_t(p * 10);
+    return p;
+}();
+
+// Values below dec_chunk^(2^dec_split_level) are converted a chunk at a time,
+// larger ones are split in halves by dividing by dec_chunk^(2^j)
+unsigned constexpr dec_split_level = 3;
+
+// Writes the base b digits of x[0, n) backwards, ending at last, and returns the
+// position of the first digit.  x is destroyed.  c = b^k is the chunk peeled off
+// by each division, and s and v its normalization and reciprocal.
+inline
+char*
+put_digits_basecase(char* last, limb_t* x, unsigned n, unsigned b,
+                    limb_t c, unsigned k, unsigned s, limb_t v) noexcept
+{
+    char* const end = last;
+    while (n > 0 && x[n-1] == 0)
+        --n;
+    while (n > 1)
+    {
+        auto r = divrem_1(x, x, n, c, s, v);
+        for (unsigned i = 0; i < k; ++i)
+        {
+            *--last = digit_chars[r % b];
+            r = limb_t(r / b);
+        }
+        if (x[n-1] == 0)
+            --n;
+    }
+    for (limb_t r = n == 0 ? 0 : x[0]; r != 0 || last == end; r = limb_t(r / b))
+        *--last = digit_chars[r % b];
+    return last;
 }
 
-template <SignTag S, unsigned N, Policy P, detail::StandardInteger I>
+// 10^i for i < 20
+inline std::array<std::uint64_t, 20> constexpr pow10_64 = []
+{
+    std::array<std::uint64_t, 20> p{1};
+    for (unsigned i = 1; i < p.size(); ++i)
+        p[i] = p[i-1] * 10;
+    return p;
+}();
+
+// The 8 decimal digits of x < 10^8, leading zeros included, as ASCII in the bytes
+// of the result, the most significant lowest.  x is split into 4-digit halves in
+// 32-bit lanes, those into 2-digit quarters in 16-bit lanes, and those into single
+// digits in 8-bit lanes, dividing every lane at once with a multiply and shift.
 constexpr
 inline
-auto
-operator/(I const& i, Z<S, N, P> const& y) noexcept(P{} != Throw{})
-    -> std::common_type_t<decltype(i), decltype(y)>
+std::uint64_t
+dec8_swar(std::uint32_t x) noexcept
 {
-    using Y = decltype(y);
-    using R = std::common_type_t<I, Y>;
-    return R{i} / R{y};
+    std::uint64_t v = x / 10000 | std::uint64_t{x % 10000} << 32;
+    auto q = (v * 10486 >> 20) & 0x0000007F0000007F;  // / 100
+    v = q | (v - q * 100) << 16;
+    q = (v * 103 >> 10) & 0x000F000F000F000F;         // / 10
+    v = q | (v - q * 10) << 8;
+    return v + 0x3030303030303030;
 }
 
-template <SignTag S1, unsigned N1, Policy P, SignTag S2, unsigned N2>
+// Writes the 8 decimal digits of x < 10^8, leading zeros included, forward from first
 constexpr
 inline
-auto
-operator%(Z<S1, N1, P> const& x, Z<S2, N2, P> const& y) noexcept(P{} != Throw{})
-    -> std::common_type_t<decltype(x), decltype(y)>
+void
+put_dec8(char* first, std::uint32_t x) noexcept
 {
-    using X = decltype(x);
-    using Y = decltype(y);
-    using R = std::common_type_t<X, Y>;
-    R a{x};
-    R b{y};
-    auto z = a - a/b*b;
-    return z;
+    auto const v = dec8_swar(x);
+    if constexpr (std::endian::native == std::endian::little)
+        std::copy_n(std::bit_cast<std::array<char, 8>>(v).data(), 8, first);
+    else
+    {
+        for (unsigned i = 0; i < 8; ++i)
+            first[i] = char(v >> 8*i);
+    }
 }
 
-template <SignTag S, unsigned N, Policy P, detail::StandardInteger I>
+// Writes the dec_chunk_digits decimal digits of c < dec_chunk, leading zeros
+// included, forward from first
 constexpr
 inline
-auto
-operator%(Z<S, N, P> const& x, I const& i) noexcept(P{} != Throw{})
-    -> std::common_type_t<decltype(x), decltype(i)>
+void
+put_dec_chunk(char* first, limb_t c) noexcept
 {
-    using X = decltype(x);
-    using R = std::common_type_t<X, I>;
-    return R{x} % R{i};
+    std::uint64_t x = c;
+    unsigned k = dec_chunk_digits;
+    for (; k > 8; k -= 8, x /= 100000000)
+        put_dec8(first + (k - 8), std::uint32_t(x % 100000000));
+    for (; k > 0; x /= 10)
+        first[--k] = char('0' + x % 10);
 }
 
-template <SignTag S, unsigned N, Policy P, detail::StandardInteger I>
+// Writes the decimal digits of c, without leading zeros, backwards ending at last,
+// and returns the position of the first digit
 constexpr
 inline
-auto
-operator%(I const& i, Z<S, N, P> const& y) noexcept(P{} != Throw{})
-    -> std::common_type_t<decltype(i), decltype(y)>
+char*
+put_dec_top(char* last, limb_t c) noexcept
 {
-    using Y = decltype(y);
-    using R = std::common_type_t<I, Y>;
-    return R{i} % R{y};
+    if (c >= dec_chunk)
+    {
+        last -= dec_chunk_digits;
+        put_dec_chunk(last, limb_t(c % dec_chunk));
+        c = limb_t(c / dec_chunk);
+    }
+    // c has d digits, and 1233/4096 is just above log10(2)
+    std::uint64_t x = c;
+    unsigned d = (unsigned(std::bit_width(x)) * 1233) >> 12;
+    d += x >= pow10_64[d];
+    d += d == 0;
+    auto const first = last - d;
+    for (; d > 8; d -= 8, x /= 100000000)
+        put_dec8(first + (d - 8), std::uint32_t(x % 100000000));
+    auto const v = dec8_swar(std::uint32_t(x)) >> 8*(8 - d);
+    for (unsigned i = 0; i < d; ++i)
+        first[i] = char(v >> 8*i);
+    return first;
+}
+
+// As put_digits_basecase in base 10, where each division is by a constant
+inline
+char*
+put_dec_basecase(char* last, limb_t* x, unsigned n) noexcept
+{
+    unsigned constexpr s = std::countl_zero(dec_chunk);
+    limb_t constexpr v = reciprocal(limb_t(dec_chunk << s));
+    while (n > 0 && x[n-1] == 0)
+        --n;
+    while (n > 1)
+    {
+        last -= dec_chunk_digits;
+        put_dec_chunk(last, divrem_1(x, x, n, dec_chunk, s, v));
+        if (x[n-1] == 0)
+            --n;
+    }
+    return put_dec_top(last, n == 0 ? 0 : x[0]);
 }
 
-namespace detail
+// As put_dec_basecase, for x < pw[j]^2 where pw[j] divides by dec_chunk^(2^j)
+template <unsigned N>
+char*
+put_dec(char* last, Z<Unsigned, N, Wrap> const& x, divider<Z<Unsigned, N, Wrap>> const* pw,
+        unsigned j) noexcept
 {
-
-template <SignTag S, unsigned N, Policy P>
-constexpr
-Z<S, N, P>
-zero_high_bit(Z<S, N, P> x) noexcept
+    if (j < dec_split_level)
+    {
+        auto a = to_limbs(x);
+        return put_dec_basecase(last, a.data(), unsigned(a.size()));
+    }
+    if (x < pw[j].divisor())
+        return put_dec(last, x, pw, j-1);
+    // The low half has exactly dec_chunk_digits << j digits, with leading zeros
+    auto const [q, r] = pw[j].divmod(x);
+    auto const mid = last - (dec_chunk_digits << j);
+    std::fill(mid, put_dec(last, r, pw, j-1), '0');
+    return put_dec(mid, q, pw, j-1);
+}
+
+// Writes the base b digits of x backwards, ending at last, and returns the position
+// of the first digit.  There must be room for N/3 + 1 digits in base 10, and for
+// 2*N/3 + 1 in the other bases.
+template <unsigned N>
+char*
+put_digits(char* last, Z<Unsigned, N, Wrap> const& x, unsigned b) noexcept
 {
-    x.zero_high_bit();
-    return x;
+    using RU = Z<Unsigned, N, Wrap>;
+
+    if (b != 10)
+    {
+        unsigned k;
+        auto const c = limb_chunk(b, k);
+        auto const s = unsigned(std::countl_zero(c));
+        auto a = to_limbs(x);
+        return put_digits_basecase(last, a.data(), unsigned(a.size()), b, c, k, s,
+                                   reciprocal(limb_t(c << s)));
+    }
+    if constexpr (N > limb_bits << dec_split_level)
+    {
+        // dec_chunk^(2^j) for every j for which it fits, computed once
+        unsigned constexpr L = std::bit_width(unsigned(std::numeric_limits<RU>::digits10) /
+                                              dec_chunk_digits);
+        static auto const pw = []<std::size_t ...j>(std::index_sequence<j...>)
+        {
+            std::array<RU, L> p{RU{dec_chunk}};
+            for (unsigned i = 1; i < L; ++i)
+                p[i] = square(p[i-1]);
+            return std::array<divider<RU>, L>{divider<RU>{p[j]}...};
+        }(std::make_index_sequence<L>{});
+        return put_dec(last, x, pw.data(), L - 1);
+    }
+    else
+    {
+        auto a = to_limbs(x);
+        return put_dec_basecase(last, a.data(), unsigned(a.size()));
+    }
 }
 
-template <SignTag S, unsigned N, Policy P>
+// Writes the len lowest base 2^k digits of x[0, n) backwards, ending at last, taking
+// each from digits.  Each digit is read straight from the limbs.
 constexpr
-Z<S, N, P>
-set_high_bit(Z<S, N, P> x) noexcept
+inline
+void
+put_pow2_digits(char* last, limb_t const* x, unsigned n, unsigned k, unsigned len,
+                char const* digits) noexcept
 {
-    x.set_high_bit();
-    return x;
+    limb_t const mask = limb_t((1u << k) - 1);
+    for (unsigned i = 0, pos = 0; i < len; ++i, pos += k)
+    {
+        auto const j = pos / limb_bits;
+        auto const off = pos % limb_bits;
+        limb_t d = limb_t(x[j] >> off);
+        if (off + k > limb_bits && j + 1 < n)
+            d |= limb_t(x[j+1] << (limb_bits - off));
+        *--last = digits[d & mask];
+    }
 }
 
+// The base b digits of x in [first, last), as std::to_chars
 template <unsigned N>
-requires(N <= Nlimit)
-constexpr
-inline
-unsigned
-divu10(Z<Unsigned, N, Wrap>& u) noexcept
+std::to_chars_result
+to_chars(char* first, char* last, Z<Unsigned, N, Wrap> const& x, unsigned b) noexcept
 {
-    unsigned r = u.rep_ % 10;
-    u.rep_ /= 10;
-    return r;
+    if (std::has_single_bit(b))
+    {
+        auto const k = unsigned(std::countr_zero(b));
+        auto const len = std::max((N - countl_zero(x) + k - 1) / k, 1u);
+        if (static_cast<std::size_t>(last - first) < len)
+            return {last, std::errc::value_too_large};
+        auto const a = to_limbs(x);
+        put_pow2_digits(first + len, a.data(), unsigned(a.size()), k, len, digit_chars);
+        return {first + len, std::errc{}};
+    }
+    std::array<char, 2*N/3 + 1> buf;  // log3(2) < 2/3
+    auto const end = buf.data() + buf.size();
+    auto const p = put_digits(end, x, b);
+    if (last - first < end - p)
+        return {last, std::errc::value_too_large};
+    return {std::copy(p, end, first), std::errc{}};
 }
 
+// The decimal digits of x
 template <unsigned N>
-requires(N > Nlimit)
-constexpr
-inline
-unsigned
-divu10(Z<Unsigned, N, Wrap>& u) noexcept
-{
-    auto q = (u >> 1) + (u >> 2);
-    for (unsigned s = 4; s < N; s *= 2)
-        q += q >> s;
-    q >>= 3;
-    // approximate remainder r >= 0
-    auto r = static_cast<unsigned>(u - ((q << 3) + (q << 1)));
-    auto c = static_cast<std::uint8_t>(r/10);
-    u = q + c;
-    r -= c * 10;
-    // remainder r is in [0, 9]
-    return r;
+std::string
+to_dec_string(Z<Unsigned, N, Wrap> const& x)
+{
+    std::array<char, N/3 + 1> buf;  // log10(2) < 1/3
+    auto const last = buf.data() + buf.size();
+    return std::string(put_digits(last, x, 10), last);
 }
 
+// The base 2^k digits of x, with uppercase letters if upper
 template <unsigned N>
-constexpr
-inline
-unsigned
-divu16(Z<Unsigned, N, Wrap>& u) noexcept
+std::string
+to_pow2_string(Z<Unsigned, N, Wrap> const& x, unsigned k, bool upper)
 {
-    unsigned r(u & 0xFu);
-    u >>= 4;
-    return r;
+    auto const len = std::max((N - countl_zero(x) + k - 1) / k, 1u);
+    std::string s(len, '\0');
+    auto const a = to_limbs(x);
+    put_pow2_digits(s.data() + len, a.data(), unsigned(a.size()), k, len,
+                    upper ? "0123456789ABCDEF" : digit_chars);
+    return s;
 }
 
-template <unsigned N>
+// The value of the k <= dec_chunk_digits decimal digits at d.  Four digits are
+// combined before they join the sum, which shortens the chain of multiplications.
 constexpr
 inline
-unsigned
-divu8(Z<Unsigned, N, Wrap>& u) noexcept
+limb_t
+parse_chunk(char const* d, unsigned k) noexcept
 {
-    unsigned r(u & 0x7u);
-    u >>= 3;
-    return r;
+    std::uint64_t c{};
+    unsigned i = 0;
+    for (; i + 4 <= k; i += 4)
+        c = c*10000 + unsigned(((d[i] - '0')*10 + (d[i+1] - '0'))*100 +
+                               (d[i+2] - '0')*10 + (d[i+3] - '0'));
+    for (; i < k; ++i)
+        c = c*10 + unsigned(d[i] - '0');
+    return limb_t(c);
 }
 
-template <unsigned N>
+// r[0, n) = the value of the dn decimal digits at d.  Requires dn <= n*dec_chunk_digits.
 constexpr
 inline
-unsigned
-divu2(Z<Unsigned, N, Wrap>& u) noexcept
+void
+parse_dec_basecase(limb_t* r, unsigned n, char const* d, unsigned dn) noexcept
 {
-    unsigned r(u & 0x1u);
-    u >>= 1;
-    return r;
+    for (unsigned j = 0; j < n; ++j)
+        r[j] = 0;
+    unsigned rn = 0;
+    unsigned i = 0;
+    auto k = (dn - 1) % dec_chunk_digits + 1;  // digits in the leading chunk
+    for (; i < dn; i += k, k = dec_chunk_digits)
+    {
+        auto const c = mul_1(r, r, rn, dec_chunk, parse_chunk(d + i, k));
+        if (c != 0)
+            r[rn++] = c;
+    }
 }
 
-}  // namespace detail
-
-template <SignTag S, unsigned N, Policy P>
-std::istream&
-operator>>(std::istream& is, Z<S, N, P>& x)
+// pw[2^k - 1, 2^(k+1) - 1) = dec_chunk^(2^k) for k < j
+template <unsigned j>
+constexpr
+void
+dec_powers(limb_t* pw) noexcept
 {
-    using traits = std::istream::traits_type;
-    bool neg = false;
-    std::ws(is);
-    auto ic = is.peek();
-    if (traits::eq_int_type(ic, traits::eof()))
+    if constexpr (j == 1)
+        pw[0] = dec_chunk;
+    else if constexpr (j > 1)
     {
-        is.setstate(std::ios::failbit);
-        return is;
+        unsigned constexpr h = 1u << (j-2);
+        dec_powers<j-1>(pw);
+        sqr_n<h>(pw + 2*h - 1, pw + h - 1);
     }
-    auto c = static_cast<char>(traits::to_char_type(ic));
-    if (('0' <= c && c <= '9') || c == '-' || c == '+')
+}
+
+// dec_powers<j>, computed once
+template <unsigned j>
+limb_t const*
+dec_pow_table() noexcept
+{
+    static auto const pw = []
     {
-        if (c == '-' || c == '+')
+        std::array<limb_t, (1u << j)> p{};
+        dec_powers<j>(p.data());
+        return p;
+    }();
+    return pw.data();
+}
+
+// Splits into halves of up to dec_table_bits take dec_chunk^h from pow10_table.
+// Wider halves take it from dec_powers, since the table would hold thousands of
+// entries of their width.
+unsigned constexpr dec_table_bits = 1024;
+
+// r[0, 2^j) = the value of the dn decimal digits at d.  Requires
+// dn <= dec_chunk_digits << j, and pw as filled by dec_powers<j> if
+// limb_bits << (j-1) > dec_table_bits.
+template <unsigned j>
+constexpr
+void
+parse_dec(limb_t* r, char const* d, unsigned dn, limb_t const* pw) noexcept
+{
+    unsigned constexpr n = 1u << j;
+    if constexpr (j <= dec_split_level)
+        parse_dec_basecase(r, n, d, dn);
+    else
+    {
+        unsigned constexpr h = n / 2;
+        unsigned constexpr m = dec_chunk_digits * h;  // digits in the low half
+        if (dn <= m)
         {
-            (void)is.get();
-            if (c == '-')
-                neg = true;
-            ic = is.peek();
-            if (traits::eq_int_type(ic, traits::eof()))
-            {
-                is.setstate(std::ios::failbit);
-                return is;
-            }
-            c = static_cast<char>(traits::to_char_type(ic));
-            if (!('0' <= c && c <= '9'))
-            {
-                is.setstate(std::ios::failbit);
-                return is;
-            }
+            parse_dec<j-1>(r, d, dn, pw);
+            for (unsigned k = h; k < n; ++k)
+                r[k] = 0;
+            return;
         }
-        (void)is.get();
-        x = Z<S, N, P>{c - '0'};
-        while (true)
+        // r = hi * dec_chunk^h + lo
+        std::array<limb_t, h> hi;
+        std::array<limb_t, h> lo;
+        parse_dec<j-1>(hi.data(), d, dn - m, pw);
+        parse_dec<j-1>(lo.data(), d + (dn - m), m, pw);
+        // dec_chunk^h == 10^m
+        std::array<limb_t, h*limb_bits <= dec_table_bits ? h : 1> pt;
+        limb_t const* p;
+        if constexpr (h*limb_bits <= dec_table_bits)
         {
-            ic = is.peek();
-            if (traits::eq_int_type(ic, traits::eof()))
-                break;
-            c = static_cast<char>(traits::to_char_type(ic));
-            if (!('0' <= c && c <= '9'))
-                break;
-            (void)is.get();
-            x = x*Z<S, N, P>{10} + Z<S, N, P>{c - '0'};
+            pt = to_limbs(pow10_table<Z<Unsigned, h*limb_bits, Wrap>>[m]);
+            p = pt.data();
+        }
+        else
+            p = pw + (h - 1);
+        unsigned hn = h;
+        while (hn > 0 && hi[hn-1] == 0)
+            --hn;
+        if (hn*limb_bits >= BBI_KARATSUBA_THRESHOLD)
+            mul_n<h>(r, hi.data(), p);
+        else
+        {
+            // A short high part is cheaper to multiply by its significant limbs
+            mul_basecase(r, hi.data(), hn, p, h);
+            for (unsigned k = h + hn; k < n; ++k)
+                r[k] = 0;
         }
-        if (neg)
-            x = -x;
+        add_1(r + h, r + h, h, add_n(r, r, lo.data(), h));
+    }
+}
+
+// The value of the dn <= digits10 + 1 decimal digits at d, modulo 2^N, and whether
+// it is below 2^N
+template <unsigned N>
+constexpr
+bool
+parse_decimal(char const* d, unsigned dn, Z<Unsigned, N, Wrap>& u) noexcept
+{
+    using RU = Z<Unsigned, N, Wrap>;
+
+    // Parse exactly into 2^J limbs
+    unsigned constexpr dmax = std::numeric_limits<RU>::digits10 + 1;
+    unsigned constexpr J = std::bit_width((dmax - 1) / dec_chunk_digits);
+    unsigned constexpr n = (N + limb_bits - 1) / limb_bits;
+    static_assert(n <= 1u << J);
+
+    std::array<limb_t, (1u << J)> a;
+    if constexpr (J <= dec_split_level || (limb_bits << J) <= 2*dec_table_bits)
+        parse_dec<J>(a.data(), d, dn, nullptr);
+    else if (std::is_constant_evaluated())
+    {
+        std::array<limb_t, (1u << J)> pw;
+        dec_powers<J>(pw.data());
+        parse_dec<J>(a.data(), d, dn, pw.data());
     }
     else
+        parse_dec<J>(a.data(), d, dn, dec_pow_table<J>());
+    u = from_limbs<N>(a.data());
+    bool fits = true;
+    for (unsigned j = n; j < a.size(); ++j)
+        fits = fits && a[j] == 0;
+    if constexpr (N < limb_bits)
+        fits = fits && (a[0] >> N) == 0;
+    return fits;
+}
+
+template <class R>
+constexpr
+R
+from_decimal(std::string_view d, bool neg)
+{
+    unsigned constexpr N = R::size;
+    using RU = Z<Unsigned, N, Wrap>;
+    using RW = Z<typename R::sign, N, Wrap>;
+
+    while (d.size() > 1 && d.front() == '0')
+        d.remove_prefix(1);
+    if (d.size() <= std::numeric_limits<RU>::digits10 + 1u)
     {
-        is.setstate(std::ios::failbit);
-        return is;
+        RU u;
+        bool fits = parse_decimal(d.data(), unsigned(d.size()), u);
+        if constexpr (typename R::sign{} == Signed{})
+            fits = fits && ((u >> (N-1)) == RU{} || (neg && u == RU{1} << (N-1)));
+        if (fits || typename R::policy{} == Wrap{})
+            return R{neg ? -RW{u} : RW{u}};
     }
-    return is;
+
+    // Out of range:  let R's arithmetic report it, or wrap an overlong string
+    R z{};
+    for (auto c : d)
+    {
+        if constexpr (typename R::sign{} == Signed{})
+            z = z*R{10} + R{-(c - '0')};
+        else
+            z = z*R{10} + R{c - '0'};
+    }
+    if constexpr (typename R::sign{} == Signed{})
+    {
+        if (!neg)
+            z = -z;
+    }
+    return z;
 }
 
-namespace detail
+// The value of c as a base b digit, or b if it isn't one
+constexpr
+inline
+unsigned
+digit_value(char c, unsigned b) noexcept
 {
+    unsigned const d = '0' <= c && c <= '9' ? unsigned(c - '0') :
+                       'a' <= c && c <= 'z' ? unsigned(c - 'a' + 10) :
+                       'A' <= c && c <= 'Z' ? unsigned(c - 'A' + 10) : 36;
+    return d < b ? d : b;
+}
 
-template <class Z>
+// The value of the dn > 0 base b digits at d, modulo 2^N, and whether it is below
+// 2^N.  A power of two base places each digit's bits directly, other bases than 10
+// accumulate a limb-sized chunk of digits at a time.
+template <unsigned N>
 constexpr
-Z
-from_string_view(std::string_view const s, unsigned* count = nullptr)
+bool
+parse_digits(char const* d, std::size_t dn, unsigned b, Z<Unsigned, N, Wrap>& u) noexcept
 {
-    auto const throw_error = [&s]()
+    unsigned constexpr n = (N + limb_bits - 1) / limb_bits;
+
+    for (; dn > 1 && *d == '0'; --dn)
+        ++d;
+    if (b == 10)
     {
-        throw std::runtime_error('\"' + std::string(s) + "\" is not a valid integer");
-    };
-    unsigned i = 0;
-    if (i == s.size())
-        throw_error();
-    if constexpr (typename Z::sign{} == Signed{})
+        if (dn > std::numeric_limits<Z<Unsigned, N, Wrap>>::digits10 + 1u)
+            return false;
+        return parse_decimal(d, unsigned(dn), u);
+    }
+    std::array<limb_t, n> a{};
+    if (std::has_single_bit(b))
     {
-        bool neg = false;
-        auto c = s[i];
-        if (c == '-' || c == '+')
-        {
-            ++i;
-            if (c == '-')
-                neg = true;
-            if (i == s.size())
-                throw_error();
-            c = s[i];
-        }
-        if (!('0' <= c && c <= '9'))
-            throw_error();
-        ++i;
-        Z z{-(c - '0')};
-        while (true)
+        auto const k = unsigned(std::countr_zero(b));
+        if (dn - 1 > N / k || (dn - 1) * k + std::bit_width(digit_value(*d, b)) > N)
+            return false;
+        for (unsigned i = 0, pos = 0; i < dn; ++i, pos += k)
         {
-            if (i == s.size())
-                break;
-            c = s[i];
-            if (!('0' <= c && c <= '9'))
-                break;
-            ++i;
-            z = z*Z{10} + Z{-(c - '0')};
+            auto const v = limb_t(digit_value(d[dn-1-i], b));
+            auto const j = pos / limb_bits;
+            auto const off = pos % limb_bits;
+            a[j] |= limb_t(v << off);
+            if (off + k > limb_bits && j + 1 < n)
+                a[j+1] |= limb_t(v >> (limb_bits - off));
         }
-        if (!neg)
-            z = -z;
-        if (count)
-            *count += i;
-        return z;
     }
     else
     {
-        auto c = s[i];
-        if (c == '+')
+        unsigned k;
+        auto const c = limb_chunk(b, k);
+        unsigned an = 0;
+        auto m = unsigned((dn - 1) % k + 1);  // digits in the leading chunk
+        for (std::size_t i = 0; i < dn; i += m, m = k)
         {
-            ++i;
-            if (i == s.size())
-                throw_error();
-            c = s[i];
+            limb_t v = 0;
+            for (unsigned t = 0; t < m; ++t)
+                v = limb_t(v * b + digit_value(d[i+t], b));
+            auto const carry = mul_1(a.data(), a.data(), an, c, v);
+            if (carry != 0)
+            {
+                if (an == n)
+                    return false;
+                a[an++] = carry;
+            }
         }
-        if (!('0' <= c && c <= '9'))
-            throw_error();
-        ++i;
-        Z z{c - '0'};
-        while (true)
+    }
+    u = from_limbs<N>(a.data());
+    if constexpr (N < limb_bits)
+        return (a[0] >> N) == 0;
+    return true;
+}
+
+// As std::from_chars, in base b
+template <class R>
+constexpr
+std::from_chars_result
+from_chars(char const* first, char const* last, R& x, unsigned b) noexcept
+{
+    unsigned constexpr N = R::size;
+    using RU = Z<Unsigned, N, Wrap>;
+    using RW = Z<typename R::sign, N, Wrap>;
+
+    auto p = first;
+    bool neg = false;
+    if constexpr (typename R::sign{} == Signed{})
+    {
+        if (p != last && *p == '-')
         {
-            if (i == s.size())
-                break;
-            c = s[i];
-            if (!('0' <= c && c <= '9'))
-                break;
-            ++i;
-            z = z*Z{10} + Z{c - '0'};
+            neg = true;
+            ++p;
         }
-        if (count)
-            *count += i;
-        return z;
     }
+    auto const d = p;
+    while (p != last && digit_value(*p, b) < b)
+        ++p;
+    if (p == d)
+        return {first, std::errc::invalid_argument};
+    RU u;
+    bool fits = parse_digits(d, static_cast<std::size_t>(p - d), b, u);
+    if constexpr (typename R::sign{} == Signed{})
+        fits = fits && ((u >> (N-1)) == RU{} || (neg && u == RU{1} << (N-1)));
+    if (!fits)
+        return {p, std::errc::result_out_of_range};
+    x = R{neg ? -RW{u} : RW{u}};
+    return {p, std::errc{}};
 }
 
 }  // namespace detail
 
-template <SignTag S, unsigned N, Policy P>
+template <unsigned N1, unsigned N2, Policy P>
+inline
 constexpr
-Z<S, N, P, true>::Z(std::string_view s)
-    : Z{detail::from_string_view<Z>(s)}
-    {}
+auto
+trunc_div(Z<Signed, N1, P> const& n, Z<Signed, N2, P> const& d) noexcept(P{} != Throw{})
+{
+    return divmod(n, d);
+}
 
-template <SignTag S, unsigned N, Policy P>
-constexpr
-Z<S, N, P, true>::Z(std::string_view s, unsigned& i)
-    : Z{detail::from_string_view<Z>(s, &i)}
-    {}
+// floor_div, ceil_div and euc_div adjust the truncated result by one when the
+// remainder has the wrong sign.  That can't overflow:  |d| >= 2 when r != 0.
+// For d == 0 and d == -1 the result is trunc_div's, which handles overflow.
 
-template <SignTag S, unsigned N, Policy P>
+template <unsigned N1, unsigned N2, Policy P>
+inline
 constexpr
-Z<S, N, P, false>::Z(std::string_view s)
-    : Z{detail::from_string_view<Z>(s)}
-    {}
+auto
+floor_div(Z<Signed, N1, P> const& n, Z<Signed, N2, P> const& d) noexcept(P{} != Throw{})
+{
+    auto r = trunc_div(n, d);
+    if (d != 0 && d != -1 && r.rem != 0 && (r.rem < 0) != (d < 0))
+    {
+        --r.quot;
+        r.rem += d;
+    }
+    return r;
+}
 
-template <SignTag S, unsigned N, Policy P>
+template <unsigned N1, unsigned N2, Policy P>
+inline
 constexpr
-Z<S, N, P, false>::Z(std::string_view s, unsigned& i)
-    : Z{detail::from_string_view<Z>(s, &i)}
-    {}
-
-template <SignTag S, unsigned N, Policy P>
-Z<S, N, P, true>::operator std::string() const
+auto
+ceil_div(Z<Signed, N1, P> const& n, Z<Signed, N2, P> const& d) noexcept(P{} != Throw{})
 {
-    return to_string(*this);
+    auto r = trunc_div(n, d);
+    if (d != 0 && d != -1 && r.rem != 0 && (r.rem < 0) == (d < 0))
+    {
+        ++r.quot;
+        r.rem -= d;
+    }
+    return r;
 }
 
-template <SignTag S, unsigned N, Policy P>
-Z<S, N, P, false>::operator std::string() const
+template <unsigned N1, unsigned N2, Policy P>
+inline
+constexpr
+auto
+euc_div(Z<Signed, N1, P> const& n, Z<Signed, N2, P> const& d) noexcept(P{} != Throw{})
 {
-    return to_string(*this);
+    auto r = trunc_div(n, d);
+    if (d != 0 && d != -1 && r.rem < 0)
+    {
+        if (d > 0)
+        {
+            --r.quot;
+            r.rem += d;
+        }
+        else
+        {
+            ++r.quot;
+            r.rem -= d;
+        }
+    }
+    return r;
 }
 
-// Policy namespaces
-
-namespace raw
+template <detail::StandardSignedInteger I1, detail::StandardSignedInteger I2>
+inline
+constexpr
+auto
+trunc_div(I1 const& n, I2 const& d) noexcept
 {
+    using R = decltype(n/d);
+    return div_t<R>{R(n/d), R(n%d)};
+}
 
-using u8   = std::uint8_t;
-using u16  = std::uint16_t;
-using u32  = std::uint32_t;
-using u64  = std::uint64_t;
-#ifndef _MSVC_LANG
-using u128 = __uint128_t;
-#endif
-
-using i8    = std::int8_t;
-using i16   = std::int16_t;
-using i32   = std::int32_t;
-using i64   = std::int64_t;
-#ifndef _MSVC_LANG
-using i128  = __int128_t;
-#endif
-
-}  // namespace raw
-
-namespace wrap
+template <detail::StandardSignedInteger I1, detail::StandardSignedInteger I2>
+inline
+constexpr
+auto
+floor_div(I1 const& n, I2 const& d) noexcept
 {
+    auto r = trunc_div(n, d);
+    if (r.rem != 0 && (r.rem < 0) != (d < 0))
+    {
+        --r.quot;
+        r.rem += d;
+    }
+    return r;
+}
 
-using u8    = Z<Unsigned,    8, Wrap>;
-using u16   = Z<Unsigned,   16, Wrap>;
-using u32   = Z<Unsigned,   32, Wrap>;
-using u64   = Z<Unsigned,   64, Wrap>;
-using u128  = Z<Unsigned,  128, Wrap>;
-using u256  = Z<Unsigned,  256, Wrap>;
-using u512  = Z<Unsigned,  512, Wrap>;
-using u1024 = Z<Unsigned, 1024, Wrap>;
-using u2048 = Z<Unsigned, 2048, Wrap>;
-using u4096 = Z<Unsigned, 4096, Wrap>;
-
-using i8    = Z<Signed,    8, Wrap>;
-using i16   = Z<Signed,   16, Wrap>;
-using i32   = Z<Signed,   32, Wrap>;
-using i64   = Z<Signed,   64, Wrap>;
-using i128  = Z<Signed,  128, Wrap>;
-using i256  = Z<Signed,  256, Wrap>;
-using i512  = Z<Signed,  512, Wrap>;
-using i1024 = Z<Signed, 1024, Wrap>;
-using i2048 = Z<Signed, 2048, Wrap>;
-using i4096 = Z<Signed, 4096, Wrap>;
-
-}  // namespace wrap
-
-namespace sat
+template <detail::StandardSignedInteger I1, detail::StandardSignedInteger I2>
+inline
+constexpr
+auto
+ceil_div(I1 const& n, I2 const& d) noexcept
 {
+    auto r = trunc_div(n, d);
+    if (r.rem != 0 && (r.rem < 0) == (d < 0))
+    {
+        ++r.quot;
+        r.rem -= d;
+    }
+    return r;
+}
 
-using u8    = Z<Unsigned,    8, Saturate>;
-using u16   = Z<Unsigned,   16, Saturate>;
-using u32   = Z<Unsigned,   32, Saturate>;
-using u64   = Z<Unsigned,   64, Saturate>;
-using u128  = Z<Unsigned,  128, Saturate>;
-using u256  = Z<Unsigned,  256, Saturate>;
-using u512  = Z<Unsigned,  512, Saturate>;
-using u1024 = Z<Unsigned, 1024, Saturate>;
-using u2048 = Z<Unsigned, 2048, Saturate>;
-using u4096 = Z<Unsigned, 4096, Saturate>;
+template <detail::StandardSignedInteger I1, detail::StandardSignedInteger I2>
+inline
+constexpr
+auto
+euc_div(I1 const& n, I2 const& d) noexcept
+{
+    auto r = trunc_div(n, d);
+    if (r.rem < 0)
+    {
+        if (d > 0)
+        {
+            --r.quot;
+            r.rem += d;
+        }
+        else
+        {
+            ++r.quot;
+            r.rem -= d;
+        }
+    }
+    return r;
+}
 
-using i8    = Z<Signed,    8, Saturate>;
-using i16   = Z<Signed,   16, Saturate>;
-using i32   = Z<Signed,   32, Saturate>;
-using i64   = Z<Signed,   64, Saturate>;
-using i128  = Z<Signed,  128, Saturate>;
-using i256  = Z<Signed,  256, Saturate>;
-using i512  = Z<Signed,  512, Saturate>;
-using i1024 = Z<Signed, 1024, Saturate>;
-using i2048 = Z<Signed, 2048, Saturate>;
-using i4096 = Z<Signed, 4096, Saturate>;
+template <class Num, unsigned N, Policy P>
+constexpr
+Num
+power(Num const& f, Z<Unsigned, N, P> n)
+{
+    if (n == 0)
+        return Num{1};
+    if (n == 1)
+        return f;
+    auto r = power(f, n >> 1);
+    if constexpr (requires {{square(r)} -> std::convertible_to<Num>;})
+        r = square(r);
+    else
+        r *= r;
+    if (n & Z<Unsigned, N, P>{1})
+        r *= f;
+    return r;
+}
 
-}  // namespace sat
+// powmod
 
-namespace thrw
+// b^e % m by sliding windows (see montgomery::pow).  An odd m multiplies in
+// Montgomery form, and any other m reduces each product with a barrett prepared
+// for m.  m == 0 is treated as b % m is.
+template <unsigned N, Policy P, unsigned Ne, Policy Pe>
+constexpr
+Z<Unsigned, N, P>
+powmod(Z<Unsigned, N, P> const& b, Z<Unsigned, Ne, Pe> const& e, Z<Unsigned, N, P> const& m)
+    noexcept(P{} != Throw{})
 {
+    using R  = Z<Unsigned, N, P>;
+    using RU = Z<Unsigned, N, Wrap>;
+    using W  = Z<Unsigned, 2*N, Wrap>;
+    if (m == 0)
+        return b % m;
+    if (m & R{1})
+    {
+        montgomery<RU> const M{RU{m}};
+        return R{M.from_mont(M.pow(M.to_mont(RU{b}), e))};
+    }
+    barrett<RU> const bm{RU{m}};
+    auto const el = detail::to_limbs(Z<Unsigned, Ne, Wrap>{e});
+    return R{detail::pow_sliding(bm.reduce(W{b}), el.data(), unsigned(el.size()), RU{1},
+                                 [&bm](RU const& x, RU const& y) {return bm.mul(x, y);})};
+}
 
-using u8    = Z<Unsigned,    8, Throw>;
-using u16   = Z<Unsigned,   16, Throw>;
-using u32   = Z<Unsigned,   32, Throw>;
-using u64   = Z<Unsigned,   64, Throw>;
-using u128  = Z<Unsigned,  128, Throw>;
-using u256  = Z<Unsigned,  256, Throw>;
-using u512  = Z<Unsigned,  512, Throw>;
-using u1024 = Z<Unsigned, 1024, Throw>;
-using u2048 = Z<Unsigned, 2048, Throw>;
-using u4096 = Z<Unsigned, 4096, Throw>;
-
-using i8    = Z<Signed,    8, Throw>;
-using i16   = Z<Signed,   16, Throw>;
-using i32   = Z<Signed,   32, Throw>;
-using i64   = Z<Signed,   64, Throw>;
-using i128  = Z<Signed,  128, Throw>;
-using i256  = Z<Signed,  256, Throw>;
-using i512  = Z<Signed,  512, Throw>;
-using i1024 = Z<Signed, 1024, Throw>;
-using i2048 = Z<Signed, 2048, Throw>;
-using i4096 = Z<Signed, 4096, Throw>;
+// b^e % m for a secret b and e, in time independent of their values (see
+// montgomery::pow_sec).  m is treated as public, and must be odd, as for montgomery.
+template <unsigned N, Policy P, unsigned Ne, Policy Pe>
+constexpr
+Z<Unsigned, N, P>
+powmod_sec(Z<Unsigned, N, P> const& b, Z<Unsigned, Ne, Pe> const& e,
+           Z<Unsigned, N, P> const& m) noexcept(P{} != Throw{})
+{
+    using R  = Z<Unsigned, N, P>;
+    montgomery<R> const M{m};
+    return M.from_mont(M.pow_sec(M.to_mont(b), e));
+}
 
-}  // namespace thrw
+namespace detail
+{
 
-namespace term
+// The 64 bits of a[0, n) from bit s up, with zeros above a[n-1]
+constexpr
+inline
+std::uint64_t
+bits_at(limb_t const* a, unsigned n, unsigned s) noexcept
 {
+    std::uint64_t r = 0;
+    for (unsigned j = s / limb_bits; j < n && j * limb_bits < s + 64; ++j)
+    {
+        auto const p = int(j * limb_bits) - int(s);
+        r |= p >= 0 ? std::uint64_t{a[j]} << p : std::uint64_t{a[j]} >> -p;
+    }
+    return r;
+}
 
-using u8    = Z<Unsigned,    8, Terminate>;
-using u16   = Z<Unsigned,   16, Terminate>;
-using u32   = Z<Unsigned,   32, Terminate>;
-using u64   = Z<Unsigned,   64, Terminate>;
-using u128  = Z<Unsigned,  128, Terminate>;
-using u256  = Z<Unsigned,  256, Terminate>;
-using u512  = Z<Unsigned,  512, Terminate>;
-using u1024 = Z<Unsigned, 1024, Terminate>;
-using u2048 = Z<Unsigned, 2048, Terminate>;
-using u4096 = Z<Unsigned, 4096, Terminate>;
+// r[0, n) = x[0, n) * p - y[0, n) * q, modulo 2^(n*limb_bits)
+constexpr
+inline
+void
+mul_sub_64(limb_t* r, limb_t const* x, std::uint64_t p, limb_t const* y, std::uint64_t q,
+           unsigned n) noexcept
+{
+    unsigned constexpr k = 64 / limb_bits;  // limbs in p and q
+    mul_1(r, x, n, limb_t(p), 0);
+    for (unsigned i = 1; i < k && i < n; ++i)
+        addmul_1(r + i, x, n - i, limb_t(p >> i*limb_bits));
+    for (unsigned i = 0; i < k && i < n; ++i)
+        submul_1(r + i, y, n - i, limb_t(q >> i*limb_bits));
+}
 
-using i8    = Z<Signed,    8, Terminate>;
-using i16   = Z<Signed,   16, Terminate>;
-using i32   = Z<Signed,   32, Terminate>;
-using i64   = Z<Signed,   64, Terminate>;
-using i128  = Z<Signed,  128, Terminate>;
-using i256  = Z<Signed,  256, Terminate>;
-using i512  = Z<Signed,  512, Terminate>;
-using i1024 = Z<Signed, 1024, Terminate>;
-using i2048 = Z<Signed, 2048, Terminate>;
-using i4096 = Z<Signed, 4096, Terminate>;
+// r[0, n) = x[0, n) * p + y[0, n) * q, modulo 2^(n*limb_bits)
+constexpr
+inline
+void
+mul_add_64(limb_t* r, limb_t const* x, std::uint64_t p, limb_t const* y, std::uint64_t q,
+           unsigned n) noexcept
+{
+    unsigned constexpr k = 64 / limb_bits;  // limbs in p and q
+    mul_1(r, x, n, limb_t(p), 0);
+    for (unsigned i = 1; i < k && i < n; ++i)
+        addmul_1(r + i, x, n - i, limb_t(p >> i*limb_bits));
+    for (unsigned i = 0; i < k && i < n; ++i)
+        addmul_1(r + i, y, n - i, limb_t(q >> i*limb_bits));
+}
 
-}  // namespace term
+// r[0, n) = x[0, n) * A + y[0, n) * B, where A and B have opposite signs (or one
+// is zero) and the result is known to be nonnegative
+constexpr
+inline
+void
+lin_comb(limb_t* r, limb_t const* x, std::int64_t A, limb_t const* y, std::int64_t B,
+         unsigned n) noexcept
+{
+    if (B <= 0)
+        mul_sub_64(r, x, std::uint64_t(A), y, std::uint64_t(-B), n);
+    else
+        mul_sub_64(r, y, std::uint64_t(B), x, std::uint64_t(-A), n);
+}
 
-template <class T>
-struct div_t
+// The matrix of a run of Euclidean steps:  a, b become A a + B b, C a + D b
+struct lehmer_t
 {
-    T quot;
-    T rem;
+    std::int64_t A;
+    std::int64_t B;
+    std::int64_t C;
+    std::int64_t D;
 };
 
-template <class T>
-auto
+// The longest run of Euclidean steps on a > b whose quotients are determined by
+// the leading bits ah and bh of a and b (Knuth's Algorithm L, steps L2 and L3).
+// A and B, and C and D, have opposite signs, and B > 0 after an odd number of steps.
 constexpr
-operator==(div_t<T> const& x, div_t<T> const& y) noexcept
+inline
+lehmer_t
+lehmer_steps(std::int64_t ah, std::int64_t bh) noexcept
 {
-    return x.quot == y.quot && x.rem == y.rem;
+    lehmer_t M{1, 0, 0, 1};
+    while (bh + M.C != 0 && bh + M.D != 0)
+    {
+        auto const q = (ah + M.A) / (bh + M.C);
+        if (q != (ah + M.B) / (bh + M.D))
+            break;
+        M = {M.C, M.D, M.A - q*M.C, M.B - q*M.D};
+        ah = std::exchange(bh, ah - q*bh);
+    }
+    return M;
 }
 
-template <class T>
-auto
+// gcd(x, y) by Lehmer's algorithm.  While x and y are long, a run of single word
+// Euclidean steps on their leading 62 bits builds up cofactors A, B, C, D for as
+// long as those bits determine the quotients.  The run is then applied to the full
+// values at once as x, y = A x + B y, C x + D y.  When the leading bits can't
+// determine even the first quotient, a full division takes the step instead.
+template <unsigned N>
 constexpr
-operator!=(div_t<T> const& x, div_t<T> const& y) noexcept
+Z<Unsigned, N, Wrap>
+gcd_lehmer(Z<Unsigned, N, Wrap> const& x, Z<Unsigned, N, Wrap> const& y) noexcept
 {
-    return !(x == y);
+    using RU = Z<Unsigned, N, Wrap>;
+    unsigned constexpr n = (N + limb_bits - 1) / limb_bits;
+
+    std::array<std::array<limb_t, n>, 4> v{to_limbs(x), to_limbs(y)};
+    auto a = v[0].data();
+    auto b = v[1].data();
+    auto t = v[2].data();
+    auto u = v[3].data();
+    // a and b fit in m limbs, and so do the limbs left in t and u
+    unsigned m = n;
+    while (true)
+    {
+        for (; m > 0 && a[m-1] == 0 && b[m-1] == 0; --m)
+        {
+            t[m-1] = 0;
+            u[m-1] = 0;
+        }
+        if (cmp_n(a, b, m) < 0)
+            std::swap(a, b);
+        unsigned const abits = m == 0 ? 0 : (m-1)*limb_bits + unsigned(std::bit_width(a[m-1]));
+        if (abits <= 64)
+            break;
+        if (std::all_of(b, b + m, [](limb_t l) {return l == 0;}))
+            return from_limbs<N>(a);
+        auto const s = abits - 62;
+        auto const M = lehmer_steps(std::int64_t(bits_at(a, m, s)),
+                                    std::int64_t(bits_at(b, m, s)));
+        if (M.B == 0)
+        {
+            // a, b = b, a % b
+            auto const r = to_limbs(from_limbs<N>(a) % from_limbs<N>(b));
+            std::copy(r.begin(), r.end(), a);
+            std::swap(a, b);
+        }
+        else
+        {
+            lin_comb(t, a, M.A, b, M.B, m);
+            lin_comb(u, a, M.C, b, M.D, m);
+            std::swap(a, t);
+            std::swap(b, u);
+        }
+    }
+    // Both now fit in a word
+    auto g = bits_at(a, m, 0);
+    auto h = bits_at(b, m, 0);
+    while (h != 0)
+    {
+        auto const r = g % h;
+        g = h;
+        h = r;
+    }
+    return RU{g};
 }
 
-template <class T>
-std::ostream&
-operator<<(std::ostream& os, div_t<T> const& x)
+// gcd(x, y) by the extended Lehmer algorithm, also setting s and t so that
+// g == s x + t y, with |s| <= max(1, y/2g) and |t| <= max(1, x/2g).  Each value a
+// carries the cofactors ua and va with a == ua x + va y.  In the Euclidean
+// sequence those cofactors alternate in sign, so only their magnitudes are kept,
+// and every run of steps, A and B having opposite signs, adds them:
+// |A ua + B ub| == |A| |ua| + |B| |ub|.  The cofactors of y are only computed when
+// with_t is set.
+template <bool with_t, unsigned N>
+constexpr
+Z<Unsigned, N, Wrap>
+ext_gcd_lehmer(Z<Unsigned, N, Wrap> const& x, Z<Unsigned, N, Wrap> const& y,
+               Z<Signed, N, Wrap>& s, Z<Signed, N, Wrap>& t) noexcept
 {
-    return os << '{' << x.quot << ", " << x.rem << '}';
+    using RS = Z<Signed, N, Wrap>;
+    unsigned constexpr n = (N + limb_bits - 1) / limb_bits;
+    unsigned constexpr k = 64 / limb_bits;  // limbs in a cofactor of a run
+
+    std::array<std::array<limb_t, n>, 4> v{to_limbs(x), to_limbs(y)};
+    auto a = v[0].data();
+    auto b = v[1].data();
+    auto ta = v[2].data();
+    auto tb = v[3].data();
+    std::array<std::array<limb_t, n>, 6> c{};
+    auto ua = c[0].data();
+    auto ub = c[1].data();
+    auto va = c[2].data();
+    auto vb = c[3].data();
+    auto tu = c[4].data();
+    auto tv = c[5].data();
+    ua[0] = 1;
+    vb[0] = 1;
+    // The sign of ua and vb; ub and va have the other sign
+    bool neg = false;
+    // a and b fit in m limbs, and so do the limbs left in ta and tb
+    unsigned m = n;
+    // The cofactors fit in w limbs, and so do the limbs left in tu and tv.  As they
+    // never decrease in magnitude, w never decreases.
+    unsigned w = 1;
+    if (cmp_n(a, b, n) < 0)
+    {
+        std::swap(a, b);
+        std::swap(ua, ub);
+        std::swap(va, vb);
+        neg = true;
+    }
+    while (true)
+    {
+        for (; m > 0 && a[m-1] == 0 && b[m-1] == 0; --m)
+        {
+            ta[m-1] = 0;
+            tb[m-1] = 0;
+        }
+        if (std::all_of(b, b + m, [](limb_t l) {return l == 0;}))
+            break;
+        unsigned const abits = (m-1)*limb_bits + unsigned(std::bit_width(a[m-1]));
+        auto const sh = abits > 62 ? abits - 62 : 0;
+        auto const M = lehmer_steps(std::int64_t(bits_at(a, m, sh)),
+                                    std::int64_t(bits_at(b, m, sh)));
+        if (M.B == 0)
+        {
+            // a, b = b, a - q b
+            auto const [q, r] = divmod(from_limbs<N>(a), from_limbs<N>(b));
+            auto const rl = to_limbs(r);
+            std::copy(rl.begin(), rl.end(), a);
+            std::swap(a, b);
+            auto const u = to_limbs(from_limbs<N>(ua) + q * from_limbs<N>(ub));
+            std::copy(u.begin(), u.end(), ua);
+            std::swap(ua, ub);
+            if constexpr (with_t)
+            {
+                auto const v = to_limbs(from_limbs<N>(va) + q * from_limbs<N>(vb));
+                std::copy(v.begin(), v.end(), va);
+                std::swap(va, vb);
+            }
+            neg = !neg;
+            w = n;
+        }
+        else
+        {
+            lin_comb(ta, a, M.A, b, M.B, m);
+            lin_comb(tb, a, M.C, b, M.D, m);
+            std::swap(a, ta);
+            std::swap(b, tb);
+            auto const mag = [](std::int64_t i) {return std::uint64_t(i < 0 ? -i : i);};
+            w = std::min(n, w + k + 1);
+            mul_add_64(tu, ua, mag(M.A), ub, mag(M.B), w);
+            mul_add_64(tv, ua, mag(M.C), ub, mag(M.D), w);
+            std::swap(ua, tu);
+            std::swap(ub, tv);
+            if constexpr (with_t)
+            {
+                mul_add_64(tu, va, mag(M.A), vb, mag(M.B), w);
+                mul_add_64(tv, va, mag(M.C), vb, mag(M.D), w);
+                std::swap(va, tu);
+                std::swap(vb, tv);
+            }
+            neg = neg != (M.B > 0);
+        }
+        // ub and vb are the larger cofactors
+        for (; w > 1 && ub[w-1] == 0 && (!with_t || vb[w-1] == 0); --w)
+            ;
+    }
+    s = RS{from_limbs<N>(ua)};
+    if (neg)
+        s = -s;
+    if constexpr (with_t)
+    {
+        t = RS{from_limbs<N>(va)};
+        if (!neg)
+            t = -t;
+    }
+    return from_limbs<N>(a);
 }
 
-template <unsigned N1, unsigned N2, Policy P>
-inline
+}  // namespace detail
+
+template <unsigned N, Policy P>
 constexpr
-auto
-trunc_div(Z<Signed, N1, P> const& n, Z<Signed, N2, P> const& d) noexcept(P{} != Throw{})
+Z<Unsigned, N, P>
+gcd(Z<Unsigned, N, P> x, Z<Unsigned, N, P> y) noexcept
 {
-    auto const q = n/d;
-    using R = decltype(q);
-    using RW = Z<Signed, R::size, Wrap>;
-    return div_t{q, R{RW{n} - RW{q}*RW{d}}};
+    if constexpr (N >= BBI_LEHMER_THRESHOLD)
+        return Z<Unsigned, N, P>{detail::gcd_lehmer(Z<Unsigned, N, Wrap>{x},
+                                                    Z<Unsigned, N, Wrap>{y})};
+    else
+    {
+        if (x == 0)
+            return y;
+        if (y == 0)
+            return x;
+        auto xd = countr_zero(x);
+        auto yd = countr_zero(y);
+        auto d = std::min(xd, yd);
+        x >>= xd;
+        y >>= yd;
+        while (x != y)
+        {
+            if (x > y)
+            {
+                x -= y;
+                x >>= countr_zero(x);
+            }
+            else
+            {
+                y -= x;
+                y >>= countr_zero(y);
+            }
+        }
+        return x << d;
+    }
 }
 
-template <unsigned N1, unsigned N2, Policy P>
-inline
+template <SignTag S1, unsigned N1, Policy P, SignTag S2, unsigned N2>
+requires (!(S1{} == Unsigned{} && S2{} == Unsigned{} && N1 == N2))
 constexpr
 auto
-floor_div(Z<Signed, N1, P> const& n, Z<Signed, N2, P> const& d) noexcept(P{} != Throw{})
+gcd(Z<S1, N1, P> x, Z<S2, N2, P> y) noexcept
 {
-    auto const np = n >= 0;
-    auto const dp = d >= 0;
-    if (np == dp || d == 0)
-        return trunc_div(n, d);
-    std::int8_t constexpr one{1};
-    using R = decltype(n/d);
-    using RW = Z<Signed, R::size, Wrap>;
-    using R2W = Z<Signed, 2*R::size, Wrap>;
-    R const q{np ? (R2W{n} - (R2W{d}+one)) / R2W{d} : (R2W{n} + (one-R2W{d})) / R2W{d}};
-    return div_t{q, R{RW{n} - RW{q}*RW{d}}};
+    using Ux = Z<Unsigned, N1, Wrap>;
+    using Uy = Z<Unsigned, N2, Wrap>;
+    Ux ux{x};
+    if constexpr (S1{} == Signed{})
+    {
+        if (x < 0)
+            ux = -ux;
+    }
+    Uy uy{y};
+    if constexpr (S2{} == Signed{})
+    {
+        if (y < 0)
+            uy = -uy;
+    }
+    using U = std::common_type_t<Ux, Uy>;
+    return Z<Unsigned, U::size, P>{gcd(U{ux}, U{uy})};
 }
 
-template <unsigned N1, unsigned N2, Policy P>
-inline
+template <unsigned N, Policy P>
 constexpr
-auto
-ceil_div(Z<Signed, N1, P> const& n, Z<Signed, N2, P> const& d) noexcept(P{} != Throw{})
+Z<Unsigned, N, P>
+lcm(Z<Unsigned, N, P> x, Z<Unsigned, N, P> y) noexcept
 {
-    auto const np = n >= 0;
-    auto const dp = d >= 0;
-    if (np != dp || d == 0)
-        return trunc_div(n, d);
-    std::int8_t constexpr one{1};
-    using R = decltype(n/d);
-    using RW = Z<Signed, R::size, Wrap>;
-    using R2W = Z<Signed, 2*R::size, Wrap>;
-    R const q{np ? (R2W{n} + (R2W{d}-one)) / R2W{d} : (R2W{n} + (R2W{d}+one)) / R2W{d}};
-    return div_t{q, R{RW{n} - RW{q}*RW{d}}};
+    if (x == 0)
+        return x;
+    if (y == 0)
+        return y;
+    return x/gcd(x, y) * y;
 }
 
-template <unsigned N1, unsigned N2, Policy P>
-inline
+template <SignTag S1, unsigned N1, Policy P, SignTag S2, unsigned N2>
+requires (!(S1{} == Unsigned{} && S2{} == Unsigned{} && N1 == N2))
 constexpr
 auto
-euc_div(Z<Signed, N1, P> const& n, Z<Signed, N2, P> const& d) noexcept(P{} != Throw{})
+lcm(Z<S1, N1, P> x, Z<S2, N2, P> y) noexcept
 {
-    auto const np = n >= 0;
-    auto const dp = d >= 0;
-    if (np || d == 0)
-        return trunc_div(n, d);
-    std::int8_t constexpr one{1};
-    using R = decltype(n/d);
-    using RW = Z<Signed, R::size, Wrap>;
-    using R2W = Z<Signed, 2*R::size, Wrap>;
-    R const q{dp ? (R2W{n} + (one-R2W{d})) / R2W{d} : (R2W{n} + (R2W{d}+one)) / R2W{d}};
-    return div_t{q, R{RW{n} - RW{q}*RW{d}}};
+    using Ux = Z<Unsigned, N1, Wrap>;
+    using Uy = Z<Unsigned, N2, Wrap>;
+    Ux ux{x};
+    if constexpr (S1{} == Signed{})
+    {
+        if (x < 0)
+            ux = -ux;
+    }
+    Uy uy{y};
+    if constexpr (S2{} == Signed{})
+    {
+        if (y < 0)
+            uy = -uy;
+    }
+    using R = Z<Unsigned, std::common_type_t<Ux, Uy>::size, P>;
+    return lcm(R{ux}, R{uy});
 }
 
-template <detail::StandardSignedInteger I1, detail::StandardSignedInteger I2>
-inline
-constexpr
+// ext_gcd
+
+// The result of ext_gcd:  g == s*x + t*y
+template <class T>
+struct ext_gcd_t
+{
+    T g;
+    Z<Signed, T::size, typename T::policy> s;
+    Z<Signed, T::size, typename T::policy> t;
+};
+
+template <class T>
 auto
-trunc_div(I1 const& n, I2 const& d) noexcept
+constexpr
+operator==(ext_gcd_t<T> const& x, ext_gcd_t<T> const& y) noexcept
 {
-    auto const q = n/d;
-    using R = decltype(q);
-    return div_t{q, R{n} - R{q}*R{d}};
+    return x.g == y.g && x.s == y.s && x.t == y.t;
 }
 
-template <detail::StandardSignedInteger I1, detail::StandardSignedInteger I2>
-requires (sizeof(I1)*CHAR_BIT <= 32 && sizeof(I2)*CHAR_BIT <= 32)
-inline
-constexpr
+template <class T>
 auto
-floor_div(I1 const& n, I2 const& d) noexcept
+constexpr
+operator!=(ext_gcd_t<T> const& x, ext_gcd_t<T> const& y) noexcept
 {
-    auto const np = n >= 0;
-    auto const dp = d >= 0;
-    if (np == dp || d == 0)
-        return trunc_div(n, d);
-    std::int8_t constexpr one{1};
-    using R = decltype(n/d);
-    using RW = R;
-    using R2W = std::int64_t;
-    static_assert(sizeof(R2W) >= 2*sizeof(RW));
-    R const q(np ? (R2W{n} - (R2W{d}+one)) / R2W{d} : (R2W{n} + (one-R2W{d})) / R2W{d});
-    return div_t{q, R{RW{n} - RW{q}*RW{d}}};
+    return !(x == y);
 }
 
-inline
+template <class T>
+std::ostream&
+operator<<(std::ostream& os, ext_gcd_t<T> const& x)
+{
+    return os << '{' << x.g << ", " << x.s << ", " << x.t << '}';
+}
+
+// Returns {g, s, t} with g == gcd(x, y) == s*x + t*y, and |s| <= max(1, |y|/2g) and
+// |t| <= max(1, |x|/2g), so that s and t always fit the signed type of the size of g.
+template <unsigned N, Policy P>
 constexpr
-auto
-floor_div(std::int64_t const& n, std::int64_t const& d) noexcept
+ext_gcd_t<Z<Unsigned, N, P>>
+ext_gcd(Z<Unsigned, N, P> x, Z<Unsigned, N, P> y) noexcept
 {
-    auto const np = n >= 0;
-    auto const dp = d >= 0;
-    if (np == dp || d == 0)
-        return trunc_div(n, d);
-    std::int8_t constexpr one{1};
-    using R = decltype(n/d);
-    using RW = R;
-    using R2W = Z<Signed, 128, Wrap>;
-    R const q(np ? (R2W{n} - (R2W{d}+one)) / R2W{d} : (R2W{n} + (one-R2W{d})) / R2W{d});
-    return div_t{q, R{RW{n} - RW{q}*RW{d}}};
+    Z<Signed, N, Wrap> s;
+    Z<Signed, N, Wrap> t;
+    auto const g = detail::ext_gcd_lehmer<true>(Z<Unsigned, N, Wrap>{x},
+                                                Z<Unsigned, N, Wrap>{y}, s, t);
+    return {Z<Unsigned, N, P>{g}, Z<Signed, N, P>{s}, Z<Signed, N, P>{t}};
 }
 
-template <detail::StandardSignedInteger I1, detail::StandardSignedInteger I2>
-requires (sizeof(I1)*CHAR_BIT <= 32 && sizeof(I2)*CHAR_BIT <= 32)
-inline
+template <SignTag S1, unsigned N1, Policy P, SignTag S2, unsigned N2>
+requires (!(S1{} == Unsigned{} && S2{} == Unsigned{} && N1 == N2))
 constexpr
 auto
-ceil_div(I1 const& n, I2 const& d) noexcept
+ext_gcd(Z<S1, N1, P> x, Z<S2, N2, P> y) noexcept
 {
-    auto const np = n >= 0;
-    auto const dp = d >= 0;
-    if (np != dp || d == 0)
-        return trunc_div(n, d);
-    std::int8_t constexpr one{1};
-    using R = decltype(n/d);
-    using RW = R;
-    using R2W = std::int64_t;
-    static_assert(sizeof(R2W) >= 2*sizeof(RW));
-    R const q(np ? (R2W{n} + (R2W{d}-one)) / R2W{d} : (R2W{n} + (R2W{d}+one)) / R2W{d});
-    return div_t{q, R{RW{n} - RW{q}*RW{d}}};
+    using Ux = Z<Unsigned, N1, Wrap>;
+    using Uy = Z<Unsigned, N2, Wrap>;
+    Ux ux{x};
+    if constexpr (S1{} == Signed{})
+    {
+        if (x < 0)
+            ux = -ux;
+    }
+    Uy uy{y};
+    if constexpr (S2{} == Signed{})
+    {
+        if (y < 0)
+            uy = -uy;
+    }
+    using U = std::common_type_t<Ux, Uy>;
+    auto r = ext_gcd(Z<Unsigned, U::size, P>{ux}, Z<Unsigned, U::size, P>{uy});
+    if constexpr (S1{} == Signed{})
+    {
+        if (x < 0)
+            r.s = -r.s;
+    }
+    if constexpr (S2{} == Signed{})
+    {
+        if (y < 0)
+            r.t = -r.t;
+    }
+    return r;
 }
 
-inline
+// mod_inverse
+
+// Returns the r in [0, m) with a*r % m == 1, or 0 if there is none (when
+// gcd(a, m) != 1, or m == 0).  Only the cofactor of a is computed.
+template <unsigned N, Policy P>
 constexpr
-auto
-ceil_div(std::int64_t const& n, std::int64_t const& d) noexcept
+Z<Unsigned, N, P>
+mod_inverse(Z<Unsigned, N, P> a, Z<Unsigned, N, P> m) noexcept
 {
-    auto const np = n >= 0;
-    auto const dp = d >= 0;
-    if (np != dp || d == 0)
-        return trunc_div(n, d);
-    std::int8_t constexpr one{1};
-    using R = decltype(n/d);
-    using RW = R;
-    using R2W = Z<Signed, 128, Wrap>;
-    R const q(np ? (R2W{n} + (R2W{d}-one)) / R2W{d} : (R2W{n} + (R2W{d}+one)) / R2W{d});
-    return div_t{q, R{RW{n} - RW{q}*RW{d}}};
+    using RU = Z<Unsigned, N, Wrap>;
+    if (m == 0)
+        return m;
+    Z<Signed, N, Wrap> s;
+    Z<Signed, N, Wrap> t;
+    if (detail::ext_gcd_lehmer<false>(RU{a}, RU{m}, s, t) != 1)
+        return {};
+    // |s| <= m/2
+    RU r{s};
+    if (s < 0)
+        r += RU{m};
+    return Z<Unsigned, N, P>{r};
+}
+
+namespace detail
+{
+
+// r[0, n) = x[0, n) * y[0, n) modulo B^n.  r must not overlap x or y.
+// Only the significant limbs of x and y are multiplied, so short operands are cheap.
+// If x and y are the same pointer, the product is computed as a square.
+template <unsigned n>
+constexpr
+void
+mullo_short(limb_t* r, limb_t const* x, limb_t const* y) noexcept
+{
+    unsigned xn = n;
+    while (xn > 0 && x[xn-1] == 0)
+        --xn;
+    unsigned yn = n;
+    while (yn > 0 && y[yn-1] == 0)
+        --yn;
+    if (xn + yn > n)
+    {
+        mullo_n<n>(r, x, y);
+        return;
+    }
+    if constexpr (n % 2 == 0)
+    {
+        if (xn <= n/2 && yn <= n/2 &&
+            std::min(xn, yn)*limb_bits >= BBI_KARATSUBA_THRESHOLD)
+        {
+            mul_n<n/2>(r, x, y);
+            return;
+        }
+    }
+    for (unsigned j = xn + yn; j < n; ++j)
+        r[j] = 0;
+    if (x == y)
+        sqr_basecase(r, x, xn);
+    else
+        mul_basecase(r, x, xn, y, yn);
 }
 
-
-template <detail::StandardSignedInteger I1, detail::StandardSignedInteger I2>
-requires (sizeof(I1)*CHAR_BIT <= 32 && sizeof(I2)*CHAR_BIT <= 32)
-inline
+// r[0, min(w 2^j, rn)) = f[0] * f[1] * ... * f[fn-1] modulo B^rn, where w is the
+// number of limbs in a std::uint64_t, and fn <= 2^j.  The factors are multiplied as
+// a balanced tree, so that most products are of short operands.
+template <unsigned j, unsigned rn>
 constexpr
-auto
-euc_div(I1 const& n, I2 const& d) noexcept
+void
+mul_tree(limb_t* r, std::uint64_t const* f, unsigned fn) noexcept
 {
-    auto const np = n >= 0;
-    auto const dp = d >= 0;
-    if (np || d == 0)
-        return trunc_div(n, d);
-    std::int8_t constexpr one{1};
-    using R = decltype(n/d);
-    using RW = R;
-    using R2W = std::int64_t;
-    static_assert(sizeof(R2W) >= 2*sizeof(RW));
-    R const q(dp ? (R2W{n} + (one-R2W{d})) / R2W{d} : (R2W{n} + (R2W{d}+one)) / R2W{d});
-    return div_t{q, R{RW{n} - RW{q}*RW{d}}};
+    unsigned constexpr n = std::min((64 / limb_bits) << j, rn);
+    if constexpr (j == 0)
+    {
+        auto const c = fn == 0 ? std::uint64_t{1} : f[0];
+        for (unsigned k = 0; k < n; ++k)
+            r[k] = limb_t(c >> k*limb_bits);
+    }
+    else
+    {
+        unsigned constexpr h = std::min((64 / limb_bits) << (j-1), rn);
+        if (fn <= 1u << (j-1))
+        {
+            mul_tree<j-1, rn>(r, f, fn);
+            for (unsigned k = h; k < n; ++k)
+                r[k] = 0;
+            return;
+        }
+        std::array<limb_t, n> a{};
+        std::array<limb_t, n> b{};
+        auto const fl = fn - fn/2;
+        mul_tree<j-1, rn>(a.data(), f, fl);
+        mul_tree<j-1, rn>(b.data(), f + fl, fn/2);
+        mullo_short<n>(r, a.data(), b.data());
+    }
 }
 
-inline
+// odd_prime[i] = whether 2i+1 is prime, for 2i+1 <= u, by the sieve of Eratosthenes
 constexpr
-auto
-euc_div(std::int64_t const& n, std::int64_t const& d) noexcept
+inline
+void
+sieve_odd_primes(bool* odd_prime, unsigned u) noexcept
 {
-    auto const np = n >= 0;
-    auto const dp = d >= 0;
-    if (np || d == 0)
-        return trunc_div(n, d);
-    std::int8_t constexpr one{1};
-    using R = decltype(n/d);
-    using RW = R;
-    using R2W = Z<Signed, 128, Wrap>;
-    R const q(dp ? (R2W{n} + (one-R2W{d})) / R2W{d} : (R2W{n} + (R2W{d}+one)) / R2W{d});
-    return div_t{q, R{RW{n} - RW{q}*RW{d}}};
+    for (unsigned i = 0; 2*i+1 <= u; ++i)
+        odd_prime[i] = i != 0;
+    for (unsigned p = 3; p*p <= u; p += 2)
+    {
+        if (odd_prime[p/2])
+        {
+            for (auto q = p*p; q <= u; q += 2*p)
+                odd_prime[q/2] = false;
+        }
+    }
 }
 
-template <class Num, unsigned N, Policy P>
+// Multiplies p < 2^32 into the last of the 64-bit factors f[0, fn), or appends it as
+// a new factor if the last is full.  So every factor but the last is at least 2^32.
 constexpr
-Num
-power(Num const& f, Z<Unsigned, N, P> n)
+inline
+void
+push_factor(std::uint64_t* f, unsigned& fn, std::uint64_t p) noexcept
 {
-    if (n == 0)
-        return Num{1};
-    if (n == 1)
-        return f;
-    auto r = power(f, n >> 1);
-    r *= r;
-    if (n & Z<Unsigned, N, P>{1})
-        r *= f;
-    return r;
+    if (fn == 0 || f[fn-1] > std::numeric_limits<std::uint64_t>::max() / p)
+        f[fn++] = p;
+    else
+        f[fn-1] *= p;
 }
 
-template <unsigned N, Policy P>
+// Packs the odd prime powers of the swing m! / floor(m/2)!^2 into 64-bit factors at
+// f and returns their number.  Prime p appears once for each odd floor(m/p^i), i >= 1.
 constexpr
-Z<Unsigned, N, P>
-gcd(Z<Unsigned, N, P> x, Z<Unsigned, N, P> y) noexcept
+inline
+unsigned
+odd_swing_factors(std::uint64_t* f, unsigned m, bool const* odd_prime) noexcept
 {
-    if (x == 0)
-        return y;
-    if (y == 0)
-        return x;
-    auto xd = countr_zero(x);
-    auto yd = countr_zero(y);
-    auto d = std::min(xd, yd);
-    x >>= xd;
-    y >>= yd;
-    while (x != y)
-    {
-        if (x > y)
-        {
-            x -= y;
-            x >>= countr_zero(x);
-        }
-        else
+    unsigned fn = 0;
+    for (unsigned p = 3; p <= m; p += 2)
+    {
+        if (odd_prime[p/2])
         {
-            y -= x;
-            y >>= countr_zero(y);
+            for (auto q = m / p; q != 0; q /= p)
+            {
+                if (q & 1)
+                    push_factor(f, fn, p);
+            }
         }
     }
-    return x << d;
+    return fn;
 }
 
-template <SignTag S1, unsigned N1, Policy P, SignTag S2, unsigned N2>
-requires (!(S1{} == Unsigned{} && S2{} == Unsigned{} && N1 == N2))
+// u! modulo 2^M by the prime swing algorithm, for u < M + 64.  With o(u) the odd part
+// of u!, o(u) == o(floor(u/2))^2 * s(u) where s(u) is the odd part of the swing of u,
+// and u! == o(u) * 2^(u - popcount(u)).  Each s(u) is a product of prime powers.
+template <unsigned M>
 constexpr
-auto
-gcd(Z<S1, N1, P> x, Z<S2, N2, P> y) noexcept
+Z<Unsigned, M, Wrap>
+fac_swing(unsigned u) noexcept
 {
-    using Ux = Z<Unsigned, N1, Wrap>;
-    using Uy = Z<Unsigned, N2, Wrap>;
-    Ux ux{x};
-    if constexpr (S1{} == Signed{})
+    using RU = Z<Unsigned, M, Wrap>;
+    unsigned constexpr rn = M / limb_bits;
+    unsigned constexpr umax = M + 64;
+
+    auto const v = u - unsigned(std::popcount(u));
+    if (v >= M)
+        return RU{};
+
+    std::array<bool, umax/2> odd_prime;
+    sieve_odd_primes(odd_prime.data(), u);
+
+    // A full factor is at least 2^32, and a swing of m is less than 4^m
+    unsigned constexpr fmax = umax/16 + 2;
+    unsigned constexpr J = std::bit_width(fmax - 1);
+    std::array<std::uint64_t, fmax> f;
+
+    std::array<limb_t, rn> r{};
+    r[0] = 1;
+    std::array<limb_t, rn> t;
+    std::array<limb_t, rn> s;
+    for (unsigned i = unsigned(std::bit_width(u)); i-- > 0;)
     {
-        if (x < 0)
-            ux = -ux;
+        auto const m = u >> i;
+        if (m < 3)
+            continue;
+        mullo_short<rn>(t.data(), r.data(), r.data());
+        mul_tree<J, rn>(s.data(), f.data(), odd_swing_factors(f.data(), m, odd_prime.data()));
+        mullo_short<rn>(r.data(), t.data(), s.data());
     }
-    Uy uy{y};
-    if constexpr (S2{} == Signed{})
+    return from_limbs<M>(r.data()) << int(v);
+}
+
+// C(n, k) modulo 2^M by its prime factorization, for n <= M.  By Kummer's theorem, the
+// exponent of p in C(n, k) is the number of carries when adding k and n - k in base p,
+// the sum over i >= 1 of floor(n/p^i) - floor(k/p^i) - floor((n-k)/p^i).
+template <unsigned M>
+constexpr
+Z<Unsigned, M, Wrap>
+binomial_prime(unsigned n, unsigned k) noexcept
+{
+    unsigned constexpr rn = M / limb_bits;
+
+    std::array<bool, M/2 + 1> odd_prime;
+    sieve_odd_primes(odd_prime.data(), n);
+
+    // A full factor is at least 2^32, and C(n, k) < 2^n
+    unsigned constexpr fmax = M/32 + 1;
+    unsigned constexpr J = std::bit_width(fmax - 1);
+    std::array<std::uint64_t, fmax> f;
+    unsigned fn = 0;
+    for (unsigned p = 3; p <= n; p += 2)
     {
-        if (y < 0)
-            uy = -uy;
+        if (odd_prime[p/2])
+        {
+            for (unsigned a = n/p, b = k/p, c = (n-k)/p; a != 0; a /= p, b /= p, c /= p)
+            {
+                for (auto e = a - b - c; e != 0; --e)
+                    push_factor(f.data(), fn, p);
+            }
+        }
     }
-    using U = std::common_type_t<Ux, Uy>;
-    return Z<Unsigned, U::size, P>{gcd(U{ux}, U{uy})};
+    std::array<limb_t, rn> r;
+    mul_tree<J, rn>(r.data(), f.data(), fn);
+    auto const e2 = std::popcount(k) + std::popcount(n - k) - std::popcount(n);
+    return from_limbs<M>(r.data()) << e2;
 }
 
-template <unsigned N, Policy P>
+// The number of n for which n! <= the max of T
+template <class T>
 constexpr
-Z<Unsigned, N, P>
-lcm(Z<Unsigned, N, P> x, Z<Unsigned, N, P> y) noexcept
+unsigned
+fac_table_size() noexcept
 {
-    if (x == 0)
-        return x;
-    if (y == 0)
-        return y;
-    return x/gcd(x, y) * y;
+    // (n-1)! < 2^N and n < 2^64, so n! is exact in 2N bits
+    unsigned constexpr N = T::size;
+    using W = Z<Unsigned, 2*N, Wrap>;
+    W const m{Z<Unsigned, N, Wrap>{std::numeric_limits<T>::max()}};
+    W r{1};
+    unsigned n = 1;
+    for (; (r = mul_u64(r, n)) <= m; ++n)
+        ;
+    return n;
 }
 
-template <SignTag S1, unsigned N1, Policy P, SignTag S2, unsigned N2>
-requires (!(S1{} == Unsigned{} && S2{} == Unsigned{} && N1 == N2))
-constexpr
-auto
-lcm(Z<S1, N1, P> x, Z<S2, N2, P> y) noexcept
+// C(n, k) for n < 64 and k <= n/2, at pascal_64[(n+1)*(n+1)/4 + k]
+inline std::array<std::uint64_t, 1056> constexpr pascal_64 = []
 {
-    using Ux = Z<Unsigned, N1, Wrap>;
-    using Uy = Z<Unsigned, N2, Wrap>;
-    Ux ux{x};
-    if constexpr (S1{} == Signed{})
+    std::array<std::uint64_t, 1056> c{};
+    for (unsigned n = 0; n < 64; ++n)
     {
-        if (x < 0)
-            ux = -ux;
+        auto const row = c.data() + (n+1)*(n+1)/4;
+        auto const prev = c.data() + n*n/4;
+        row[0] = 1;
+        for (unsigned k = 1; k <= n/2; ++k)
+            row[k] = prev[k-1] + (k <= (n-1)/2 ? prev[k] : prev[k-1]);
     }
-    Uy uy{y};
-    if constexpr (S2{} == Signed{})
+    return c;
+}();
+
+}  // namespace detail
+
+// n! for every n with n! <= the max of T
+template <detail::isZ T>
+std::array<T, detail::fac_table_size<T>()> constexpr fac_table = []
+{
+    using RU = Z<Unsigned, T::size, Wrap>;
+    std::array<T, detail::fac_table_size<T>()> f;
+    RU x{1};
+    for (unsigned n = 0; n < f.size(); ++n)
     {
-        if (y < 0)
-            uy = -uy;
+        if (n > 1)
+            x = detail::mul_u64(x, n);
+        f[n] = T{x};
     }
-    using R = Z<Unsigned, std::common_type_t<Ux, Uy>::size, P>;
-    return lcm(R{ux}, R{uy});
-}
+    return f;
+}();
 
 template <unsigned N, Policy P>
 constexpr
 Z<Unsigned, N, P>
 fac(Z<Unsigned, N, P> x)
 {
-    auto constexpr one = Z<Unsigned, N, P>{1};
-    auto r = one;
-    if (x > one)
+    using R = Z<Unsigned, N, P>;
+    if constexpr (P{} == Wrap{})
     {
-        for (; x != one; --x)
-            r *= x;
+        // x! has x - popcount(x) factors of 2
+        if (x >= R{N + 64})
+            return R{};
+        if constexpr (N <= Nlimit)
+        {
+            auto const& t = fac_table<R>;
+            if (x < R{t.size()})
+                return t[unsigned(x)];
+            auto r = t.back();
+            for (auto k = R{t.size()}; k <= x; ++k)
+                r *= k;
+            return r;
+        }
+        else
+            return detail::fac_swing<N>(unsigned(x));
+    }
+    else
+    {
+        R r;
+        bool fits;
+        if constexpr (N <= Nlimit)
+        {
+            // Every x! that fits is in the table
+            auto const& t = fac_table<R>;
+            fits = x < R{t.size()};
+            if (fits)
+                r = t[unsigned(x)];
+        }
+        else
+        {
+            // x! >= 2^L with L the sum of floor(log2(k)) for k in [2, x], and
+            // x! < 2^(L+x).  So if L < N, x! is computed exactly in 2N bits.
+            using W = Z<Unsigned, 2*N, Wrap>;
+            fits = x < R{N};
+            if (fits)
+            {
+                auto const u = unsigned(x);
+                unsigned L = 0;
+                for (unsigned j = 1; j < 32 && (1u << j) <= u; ++j)
+                    L += u - (1u << j) + 1;
+                fits = L < N;
+                if (fits)
+                {
+                    auto const w = detail::fac_swing<2*N>(u);
+                    fits = (w >> N) == W{};
+                    r = R{Z<Unsigned, N, Wrap>{w}};
+                }
+            }
+        }
+        if (!fits)
+        {
+            if constexpr (P{} == Saturate{})
+                return std::numeric_limits<R>::max();
+            else
+            {
+                auto const msg = "fac(" + to_string<R>() + '{' + to_string(x) +
+                                 "}) overflowed";
+                if constexpr (P{} == Throw{})
+                    throw std::overflow_error(msg);
+                else
+                {
+                    std::cerr << msg << '\n';
+                    std::terminate();
+                }
+            }
+        }
+        return r;
     }
-    return r;
 }
 
 template <unsigned N, Policy P>
@@ -4096,6 +7222,41 @@ binomial_coefficient(Z<Unsigned, Nx, P> n, Z<Unsigned, Ny, P> k)
         kc = nc - kc;
     if (kc == V{0})
         return V{1};
+    // C(n, k) < 2^n, so for n <= 2N it is computed exactly in M >= 2N bits.  Rows
+    // n < 64 are looked up.
+    unsigned constexpr N = V::size;
+    if (nc < V{64} || nc <= V{2*N})
+    {
+        // at least 2 limbs, and at least 64 bits
+        unsigned constexpr M = std::max(2*std::max(N, detail::limb_bits), 64u);
+        using W = Z<Unsigned, M, Wrap>;
+        auto const u = unsigned(nc);
+        auto const v = unsigned(kc);
+        auto const r = u < 64 ? W{detail::pascal_64[(u+1)*(u+1)/4 + v]}
+                              : detail::binomial_prime<M>(u, v);
+        if constexpr (P{} != Wrap{})
+        {
+            if ((r >> N) != W{})
+            {
+                if constexpr (P{} == Saturate{})
+                    return std::numeric_limits<V>::max();
+                else
+                {
+                    auto const msg = "binomial_coefficient(" + to_string<V>() + '{' +
+                                     to_string(nc) + "}, " + to_string<V>() + '{' +
+                                     to_string(V{k}) + "}) overflowed";
+                    if constexpr (P{} == Throw{})
+                        throw std::overflow_error(msg);
+                    else
+                    {
+                        std::cerr << msg << '\n';
+                        std::terminate();
+                    }
+                }
+            }
+        }
+        return V{Z<Unsigned, N, Wrap>{r}};
+    }
     auto r = nc;
     --nc;
     for (auto j = V{2}; j <= kc; ++j, --nc)
@@ -4120,6 +7281,145 @@ binomial_coefficient(Z<Sx, Nx, P> n, Z<Sy, Ny, P> k)
     return V{binomial_coefficient(VU{n}, VU{k})};
 }
 
+namespace detail
+{
+
+// floor(sqrt(x)) by Newton's method from above
+constexpr
+inline
+std::uint64_t
+isqrt_64(std::uint64_t x) noexcept
+{
+    if (x == 0)
+        return 0;
+    auto y = std::uint64_t{1} << (std::bit_width(x) + 1) / 2;  // > sqrt(x)
+    for (auto z = (y + x/y) / 2; z < y; z = (y + x/y) / 2)
+        y = z;
+    return y;
+}
+
+// squares_mod<m>[r] is true if r is a square modulo m
+template <unsigned m>
+std::array<bool, m> constexpr squares_mod = []
+{
+    std::array<bool, m> t{};
+    for (unsigned i = 0; i < m; ++i)
+        t[i*i % m] = true;
+    return t;
+}();
+
+}  // namespace detail
+
+// isqrt
+
+// floor(sqrt(x)), by Newton's method from above.  The seed is the square root of the
+// leading 63 or 64 bits of x, plus one, so each step doubles about 32 correct bits.
+template <unsigned N, Policy P>
+constexpr
+Z<Unsigned, N, P>
+isqrt(Z<Unsigned, N, P> const& x)
+{
+    using RU = Z<Unsigned, N, Wrap>;
+    RU const u{x};
+    auto const b = N - countl_zero(u);
+    if (b <= 64)
+        return Z<Unsigned, N, P>{RU{detail::isqrt_64(std::uint64_t(u))}};
+    // sqrt(x) < sqrt(floor(x / 4^s) + 1) * 2^s <= (t + 1) * 2^s
+    auto const s = (b - 63) / 2;
+    auto y = (RU{detail::isqrt_64(std::uint64_t(u >> int(2*s)))} + RU{1}) << int(s);
+    for (auto z = (y + u / y) >> 1; z < y; z = (y + u / y) >> 1)
+        y = z;
+    return Z<Unsigned, N, P>{y};
+}
+
+template <unsigned N, Policy P>
+constexpr
+Z<Signed, N, P>
+isqrt(Z<Signed, N, P> const& x)
+{
+    using Zu = Z<Unsigned, N, P>;
+    using Zs = Z<Signed, N, P>;
+    return Zs{isqrt(Zu{x})};
+}
+
+// iroot
+
+// floor(x^(1/k)) for k > 0, by Newton's method from above, seeded with 2^ceil(b/k)
+// where b is the bit width of x
+template <unsigned N, Policy P>
+constexpr
+Z<Unsigned, N, P>
+iroot(Z<Unsigned, N, P> const& x, unsigned k)
+{
+    assert(k > 0);
+    using R = Z<Unsigned, N, P>;
+    using RU = Z<Unsigned, N, Wrap>;
+    if (k == 2)
+        return isqrt(x);
+    RU const u{x};
+    auto const b = N - countl_zero(u);
+    if (k == 1 || b <= 1)
+        return x;
+    // 2 <= x < 2^b <= 2^k
+    if (k >= b)
+        return R{1};
+    // y^(k-1) saturates, and then u / y^(k-1) is 0 or 1 where it should be 0.  That
+    // still gives y > z >= floor(x^(1/k)).
+    using RS = Z<Unsigned, N, Saturate>;
+    RU const kc{k};
+    RU const km1{k - 1};
+    auto y = RU{1} << int((b + k - 1) / k);
+    while (true)
+    {
+        auto const z = (km1 * y + u / RU{power(RS{y}, km1)}) / kc;
+        if (z >= y)
+            return R{y};
+        y = z;
+    }
+}
+
+template <unsigned N, Policy P>
+constexpr
+Z<Signed, N, P>
+iroot(Z<Signed, N, P> const& x, unsigned k)
+{
+    using Zu = Z<Unsigned, N, P>;
+    using Zs = Z<Signed, N, P>;
+    return Zs{iroot(Zu{x}, k)};
+}
+
+// is_perfect_square
+
+// Whether x == isqrt(x)^2.  Most non-squares are ruled out by their residues modulo
+// 64, 63, 65 and 11 before a root is taken.
+template <unsigned N, Policy P>
+constexpr
+bool
+is_perfect_square(Z<Unsigned, N, P> const& x) noexcept
+{
+    using RU = Z<Unsigned, N, Wrap>;
+    RU const u{x};
+    if (!detail::squares_mod<64>[unsigned(u) & 63])
+        return false;
+    if constexpr (N >= 16)
+    {
+        auto const r = unsigned(u % RU{63*65*11});
+        if (!detail::squares_mod<63>[r % 63] || !detail::squares_mod<65>[r % 65] ||
+            !detail::squares_mod<11>[r % 11])
+            return false;
+    }
+    auto const r = isqrt(u);
+    return r * r == u;
+}
+
+template <unsigned N, Policy P>
+constexpr
+bool
+is_perfect_square(Z<Signed, N, P> const& x) noexcept
+{
+    return x >= Z<Signed, N, P>{0} && is_perfect_square(Z<Unsigned, N, Wrap>{x});
+}
+
 template <detail::isZ Z1, detail::isZ Z2>
 constexpr
 bool
@@ -4470,38 +7770,26 @@ std::formatter<bbi::Z<S, N, P>>::to_base_string(bbi::Z<S, N, P> const& xvalue,
 
     bbi::Z<bbi::Unsigned, N, bbi::Wrap> working_val{value};
     std::string digits_out;
-    const char* const digits = upper_case ? "0123456789ABCDEF" : "0123456789abcdef";
     if (base_specifier == 'x' || base_specifier == 'X')
     {
         if (show_base)
             prefix += upper_case ? "0X" : "0x";
-        do
-            digits_out.push_back(digits[bbi::detail::divu16(working_val)]);
-        while (working_val);
+        digits_out = bbi::detail::to_pow2_string(working_val, 4, upper_case);
     }
     else if (base_specifier == 'b' || base_specifier == 'B')
     {
         if (show_base)
             prefix += upper_case ? "0B" : "0b";
-        do
-            digits_out.push_back(digits[bbi::detail::divu2(working_val)]);
-        while (working_val);
+        digits_out = bbi::detail::to_pow2_string(working_val, 1, upper_case);
     }
     else if (base_specifier == 'o')
     {
         if (show_base)
             prefix += "0";
-        do
-            digits_out.push_back(digits[bbi::detail::divu8(working_val)]);
-        while (working_val);
+        digits_out = bbi::detail::to_pow2_string(working_val, 3, upper_case);
     }
     else
-    {
-        do
-            digits_out.push_back(digits[bbi::detail::divu10(working_val)]);
-        while (working_val);
-    }
-    std::reverse(digits_out.begin(), digits_out.end());
+        digits_out = bbi::detail::to_dec_string(working_val);
 
     // Apply localization formatting safely on base digits before prefix
     return prefix + apply_locale(std::move(digits_out), loc);
@@ -4515,14 +7803,109 @@ inline
 std::ostream&
 operator<<(std::ostream& os, Z<S, N, P> const& x)
 {
-    return os << std::format("{}", x);
+    return os << to_string(x);
 }
 
 template <SignTag S, unsigned N, Policy P>
 std::string
 to_string(Z<S, N, P> const& x)
 {
-    return std::format("{}", x);
+    using RW = Z<S, N, Wrap>;
+    using RU = Z<Unsigned, N, Wrap>;
+
+    RW const w{x};
+    if (w < RW{})
+        return '-' + detail::to_dec_string(RU{-w});
+    return detail::to_dec_string(RU{w});
+}
+
+// std::to_chars for Z:  the digits of x in base 2 through 36, lowercase, preceded
+// by '-' if negative.  Reports errc::value_too_large if they don't fit in
+// [first, last).
+template <SignTag S, unsigned N, Policy P>
+std::to_chars_result
+to_chars(char* first, char* last, Z<S, N, P> const& x, int base = 10) noexcept
+{
+    assert(2 <= base && base <= 36);
+    using RW = Z<S, N, Wrap>;
+    using RU = Z<Unsigned, N, Wrap>;
+
+    RW const w{x};
+    if (w < RW{})
+    {
+        if (first == last)
+            return {last, std::errc::value_too_large};
+        *first = '-';
+        return detail::to_chars(first + 1, last, RU{-w}, unsigned(base));
+    }
+    return detail::to_chars(first, last, RU{w}, unsigned(base));
+}
+
+// std::from_chars for Z:  parses an optional '-' (signed types only) and base 2
+// through 36 digits.  Reports errc::invalid_argument if there are no digits, and
+// errc::result_out_of_range if their value doesn't fit, regardless of P.  x is
+// modified only on success.
+template <SignTag S, unsigned N, Policy P>
+constexpr
+std::from_chars_result
+from_chars(char const* first, char const* last, Z<S, N, P>& x, int base = 10) noexcept
+{
+    assert(2 <= base && base <= 36);
+    return detail::from_chars(first, last, x, unsigned(base));
+}
+
+// Writes the N/8 bytes of x's two's complement representation to the front of out,
+// in byte order e.  out must hold at least N/8 bytes.  In native order on a
+// little-endian target that is a copy of the limbs.
+template <SignTag S, unsigned N, Policy P>
+constexpr
+void
+to_bytes(Z<S, N, P> const& x, std::span<std::byte> out,
+         std::endian e = std::endian::native) noexcept
+{
+    using detail::limb_t;
+    unsigned constexpr nb = N / CHAR_BIT;
+    assert(out.size() >= nb);
+
+    auto const a = detail::to_limbs(Z<Unsigned, N, Wrap>{Z<S, N, Wrap>{x}});
+    if (std::endian::native == std::endian::little && e == std::endian::little &&
+        !std::is_constant_evaluated())
+        std::memcpy(out.data(), a.data(), nb);
+    else
+    {
+        for (unsigned i = 0; i < nb; ++i)
+        {
+            auto const b = std::byte(a[i / sizeof(limb_t)] >> CHAR_BIT*(i % sizeof(limb_t)));
+            out[e == std::endian::little ? i : nb - 1 - i] = b;
+        }
+    }
+}
+
+// The X whose two's complement representation is the first X::size/8 bytes of in,
+// in byte order e.  in must hold at least X::size/8 bytes.
+template <detail::isZ X>
+constexpr
+X
+from_bytes(std::span<std::byte const> in, std::endian e = std::endian::native) noexcept
+{
+    using detail::limb_t;
+    unsigned constexpr N = X::size;
+    unsigned constexpr nb = N / CHAR_BIT;
+    assert(in.size() >= nb);
+
+    std::array<limb_t, (N + detail::limb_bits - 1) / detail::limb_bits> a{};
+    if (std::endian::native == std::endian::little && e == std::endian::little &&
+        !std::is_constant_evaluated())
+        std::memcpy(a.data(), in.data(), nb);
+    else
+    {
+        for (unsigned i = 0; i < nb; ++i)
+        {
+            auto const b = std::to_integer<limb_t>(in[e == std::endian::little ? i : nb - 1 - i]);
+            a[i / sizeof(limb_t)] |= limb_t(b << CHAR_BIT*(i % sizeof(limb_t)));
+        }
+    }
+    return X{Z<typename X::sign, N, Wrap>{detail::from_limbs<N>(a.data())}};
 }
 
 }  // namespace bbi;
@@ -0,0 +1,348 @@
+// Micro-benchmarks for the wide integer kernels.
+//
+// Build and run with, e.g.:
+//
+//   clang++ -std=c++20 -O3 -DNDEBUG bench.cpp -o bench && ./bench
+//
+// Build with -DBBI_CARRY_INTRINSICS=0 to compare against the portable kernels,
+// and vary -DBBI_KARATSUBA_THRESHOLD, -DBBI_TOOM3_THRESHOLD and
+// -DBBI_LEHMER_THRESHOLD to find the multiplication and gcd crossovers.
+
+#include "bbi.h"
+#include <array>
+#include <chrono>
+#include <cstdio>
+#include <random>
+
+using namespace bbi;
+
+std::mt19937_64 eng;
+
+template <class T>
+inline
+void
+do_not_optimize(T const& t)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "r,m"(t) : "memory");
+#else
+    static T volatile* volatile sink;
+    sink = const_cast<T*>(&t);
+#endif
+}
+
+template <class T>
+T
+random_value()
+{
+    using U = Z<Unsigned, T::size, Wrap>;
+    U u{};
+    for (unsigned i = 0; i < T::size; i += 64)
+        u = (u << (i == 0 ? 0 : 64)) | U{eng()};
+    return T{u};
+}
+
+// Average nanoseconds per call of f over enough iterations to fill about 50ms
+template <class F>
+double
+ns_per_op(F f)
+{
+    using clock = std::chrono::steady_clock;
+    using ns = std::chrono::duration<double, std::nano>;
+    unsigned reps = 1;
+    while (true)
+    {
+        auto t0 = clock::now();
+        for (unsigned i = 0; i < reps; ++i)
+            f();
+        auto t = ns{clock::now() - t0};
+        if (t > std::chrono::milliseconds{50})
+            return t.count() / reps;
+        reps *= 2;
+    }
+}
+
+template <class T>
+void
+bench_add_sub(char const* name)
+{
+    auto x = random_value<T>();
+    auto const y = random_value<T>();
+    auto add = ns_per_op([&] {x = x + y; do_not_optimize(x);});
+    auto sub = ns_per_op([&] {x = x - y; do_not_optimize(x);});
+    std::printf("%-6s  + %9.2f ns    - %9.2f ns\n", name, add, sub);
+}
+
+template <class T>
+void
+bench_mul(char const* name)
+{
+    auto x = random_value<T>();
+    auto const y = random_value<T>() | T{1};
+    auto mul = ns_per_op([&] {x = x * y; do_not_optimize(x);});
+    auto sqr = ns_per_op([&] {x = square(x | T{1}); do_not_optimize(x);});
+    std::printf("%-6s  * %9.0f ns    square %9.0f ns\n", name, mul, sqr);
+}
+
+template <class T>
+void
+bench_div(char const* name)
+{
+    auto const x = random_value<T>();
+    auto const y = random_value<T>() >> T::size/2;
+    auto q = x;
+    auto r = x;
+    auto div = ns_per_op([&] {q = x / (y | q); do_not_optimize(q);});
+    auto mod = ns_per_op([&] {r = x % (y | r); do_not_optimize(r);});
+    std::printf("%-6s  / %9.0f ns    %% %9.0f ns\n", name, div, mod);
+}
+
+template <class T>
+void
+bench_div_by(char const* name)
+{
+    auto x = random_value<T>();
+    T const c{1000};
+    auto div = ns_per_op([&] {x = x / c + x; do_not_optimize(x);});
+    auto div_c = ns_per_op([&] {x = div_by<1000>(x) + x; do_not_optimize(x);});
+    std::printf("%-6s  / 1000 %9.0f ns    div_by<1000> %9.0f ns\n", name, div, div_c);
+}
+
+template <class T>
+void
+bench_divider(char const* name)
+{
+    auto const x = random_value<T>();
+    auto const d = random_value<T>() >> T::size/2;
+    divider<T> const dv{d};
+    auto q = x;
+    auto div = ns_per_op([&] {q = (x | (q & T{1})) / d; do_not_optimize(q);});
+    auto quot = ns_per_op([&] {q = dv.quot(x | (q & T{1})); do_not_optimize(q);});
+    std::printf("%-6s  / %9.0f ns    divider::quot %9.0f ns\n", name, div, quot);
+}
+
+template <class T>
+void
+bench_to_string(char const* name)
+{
+    auto const x = random_value<T>();
+    auto str = ns_per_op([&] {auto s = to_string(x); do_not_optimize(s);});
+    auto const s = to_string(x);
+    auto parse = ns_per_op([&] {T y{s}; do_not_optimize(y);});
+    std::printf("%-6s  to_string %9.0f ns    from string %9.0f ns\n", name, str, parse);
+}
+
+template <class T>
+void
+bench_gcd(char const* name)
+{
+    auto const x = random_value<T>();
+    auto const y = random_value<T>();
+    auto g = x;
+    auto t = ns_per_op([&] {g = gcd(x | (g & T{1}), y); do_not_optimize(g);});
+    auto e = ns_per_op([&] {g = ext_gcd(x | (g & T{1}), y).g; do_not_optimize(g);});
+    std::printf("%-6s  gcd %9.0f ns    ext_gcd %9.0f ns\n", name, t, e);
+}
+
+template <class T>
+void
+bench_montgomery(char const* name)
+{
+    using W = Z<Unsigned, 2*T::size, Wrap>;
+    auto const m = random_value<T>() | T{1};
+    auto x = random_value<T>() % m;
+    auto const y = random_value<T>() % m;
+    auto mulmod = ns_per_op([&] {x = T{W{x} * W{y} % W{m}}; do_not_optimize(x);});
+    montgomery<T> const M{m};
+    auto xm = M.to_mont(x);
+    auto const ym = M.to_mont(y);
+    auto mont = ns_per_op([&] {xm = xm * ym; do_not_optimize(xm);});
+    std::printf("%-6s  x*y %% m %9.0f ns    montgomery %9.0f ns\n", name, mulmod, mont);
+}
+
+template <class T>
+void
+bench_barrett(char const* name)
+{
+    using W = Z<Unsigned, 2*T::size, Wrap>;
+    auto const m = random_value<T>() & ~T{1};
+    auto const x = random_value<W>();
+    barrett<T> const bm{m};
+    T r{};
+    auto mod = ns_per_op([&] {r = T{(x ^ W{r & T{1}}) % W{m}}; do_not_optimize(r);});
+    auto red = ns_per_op([&] {r = bm.reduce(x ^ W{r & T{1}}); do_not_optimize(r);});
+    std::printf("%-6s  %% %9.0f ns    barrett::reduce %9.0f ns\n", name, mod, red);
+}
+
+template <class T>
+void
+bench_powmod(char const* name)
+{
+    auto const m = random_value<T>() | T{1};
+    auto const b = random_value<T>() % m;
+    auto const e = random_value<T>();
+    auto r = b;
+    auto pm = ns_per_op([&] {r = powmod(b, e ^ (r & T{1}), m); do_not_optimize(r);});
+    auto sec = ns_per_op([&] {r = powmod_sec(b, e ^ (r & T{1}), m); do_not_optimize(r);});
+    auto even = ns_per_op([&] {r = powmod(b, e ^ (r & T{1}), m - T{1}); do_not_optimize(r);});
+    std::printf("%-6s  powmod %9.0f ns    powmod_sec %9.0f ns    even m %9.0f ns\n",
+                name, pm, sec, even);
+}
+
+template <class T>
+void
+bench_fac(char const* name, unsigned n)
+{
+    T x{n};
+    auto r = x;
+    auto loop = ns_per_op([&] {r = T{1}; for (auto k = x | (r & T{1}); k > T{1}; --k) r *= k;
+                               do_not_optimize(r);});
+    auto f = ns_per_op([&] {r = fac(x | (r & T{1})); do_not_optimize(r);});
+    std::printf("%-6s  %u! by countdown %9.0f ns    fac %9.0f ns\n", name, n, loop, f);
+}
+
+template <class T>
+void
+bench_binomial(char const* name)
+{
+    T const n{T::size};
+    auto r = n;
+    // The gcd reduced product that binomial_coefficient uses when n > 2N
+    auto loop = ns_per_op([&]
+    {
+        auto k = n / T{2} - (r & T{1});
+        auto m = n;
+        r = m--;
+        for (auto j = T{2}; j <= k; ++j, --m)
+        {
+            auto const g = gcd(r, j);
+            r = r / g * (m / (j / g));
+        }
+        do_not_optimize(r);
+    });
+    auto bc = ns_per_op([&] {r = binomial_coefficient(n, n / T{2} - (r & T{1}));
+                             do_not_optimize(r);});
+    std::printf("%-6s  C(%u, %u) by gcd loop %9.0f ns    binomial_coefficient %9.0f ns\n",
+                name, T::size, T::size/2, loop, bc);
+}
+
+// Time each multiplication algorithm at the top level for n-limb operands.
+// Below the top level, each recurses as selected by the thresholds.
+template <unsigned n>
+void
+bench_mul_kernels()
+{
+    using namespace bbi::detail;
+    std::array<limb_t, n> x;
+    std::array<limb_t, n> y;
+    std::array<limb_t, 2*n> r;
+    for (unsigned i = 0; i < n; ++i)
+    {
+        x[i] = limb_t(eng());
+        y[i] = limb_t(eng());
+    }
+    auto school = ns_per_op([&] {mul_basecase(r.data(), x.data(), n, y.data(), n);
+                                 do_not_optimize(r);});
+    auto kara = ns_per_op([&] {mul_karatsuba<n>(r.data(), x.data(), y.data());
+                               do_not_optimize(r);});
+    auto toom = ns_per_op([&] {mul_toom3<n>(r.data(), x.data(), y.data());
+                               do_not_optimize(r);});
+    std::printf("%6u bits  schoolbook %10.0f ns  Karatsuba %10.0f ns  Toom-3 %10.0f ns\n",
+                n*limb_bits, school, kara, toom);
+}
+
+int
+main()
+{
+#if defined(BBI_HAS_ADDCLL)
+    std::printf("add/sub: __builtin_addcll\n");
+#elif defined(BBI_HAS_ADDCARRY_U64)
+    std::printf("add/sub: _addcarry_u64\n");
+#else
+    std::printf("add/sub: portable\n");
+#endif
+    bench_add_sub<wrap::u256>("u256");
+    bench_add_sub<wrap::u512>("u512");
+    bench_add_sub<wrap::u1024>("u1024");
+    bench_add_sub<wrap::u2048>("u2048");
+    bench_add_sub<wrap::u4096>("u4096");
+
+    std::printf("\nmul: Karatsuba at %u bits and up\n", BBI_KARATSUBA_THRESHOLD);
+    bench_mul<wrap::u256>("u256");
+    bench_mul<wrap::u512>("u512");
+    bench_mul<wrap::u1024>("u1024");
+    bench_mul<wrap::u2048>("u2048");
+    bench_mul<wrap::u4096>("u4096");
+    bench_mul<Z<Unsigned, 8192, Wrap>>("u8192");
+    bench_mul<Z<Unsigned, 16384, Wrap>>("u16384");
+
+    std::printf("\ndiv: N-bit by N/2-bit\n");
+    bench_div<wrap::u128>("u128");
+    bench_div<wrap::u256>("u256");
+    bench_div<wrap::u512>("u512");
+    bench_div<wrap::u1024>("u1024");
+    bench_div<wrap::u2048>("u2048");
+    bench_div<wrap::u4096>("u4096");
+
+    std::printf("\ndiv by a constant\n");
+    bench_div_by<wrap::u128>("u128");
+    bench_div_by<wrap::u256>("u256");
+    bench_div_by<wrap::u1024>("u1024");
+    bench_div_by<wrap::u4096>("u4096");
+
+    std::printf("\ndiv by a runtime N/2-bit divisor\n");
+    bench_divider<wrap::u64>("u64");
+    bench_divider<wrap::u128>("u128");
+    bench_divider<wrap::u256>("u256");
+    bench_divider<wrap::u1024>("u1024");
+    bench_divider<wrap::u4096>("u4096");
+
+    std::printf("\ndecimal conversion\n");
+    bench_to_string<wrap::u128>("u128");
+    bench_to_string<wrap::u256>("u256");
+    bench_to_string<wrap::u512>("u512");
+    bench_to_string<wrap::u1024>("u1024");
+    bench_to_string<wrap::u4096>("u4096");
+    bench_to_string<Z<Unsigned, 16384, Wrap>>("u16384");
+
+    std::printf("\ngcd: Lehmer at %u bits and up\n", BBI_LEHMER_THRESHOLD);
+    bench_gcd<wrap::u128>("u128");
+    bench_gcd<wrap::u256>("u256");
+    bench_gcd<wrap::u1024>("u1024");
+    bench_gcd<wrap::u4096>("u4096");
+
+    std::printf("\nmodular multiplication\n");
+    bench_montgomery<wrap::u256>("u256");
+    bench_montgomery<wrap::u1024>("u1024");
+    bench_montgomery<wrap::u4096>("u4096");
+
+    std::printf("\n2N-bit by N-bit remainder, even modulus\n");
+    bench_barrett<wrap::u256>("u256");
+    bench_barrett<wrap::u1024>("u1024");
+    bench_barrett<wrap::u4096>("u4096");
+
+    std::printf("\nmodular exponentiation, N-bit exponent\n");
+    bench_powmod<wrap::u256>("u256");
+    bench_powmod<wrap::u1024>("u1024");
+    bench_powmod<wrap::u2048>("u2048");
+
+    std::printf("\nfactorial and binomial coefficients\n");
+    bench_fac<wrap::u64>("u64", 20);
+    bench_fac<wrap::u256>("u256", 57);
+    bench_fac<wrap::u1024>("u1024", 170);
+    bench_fac<wrap::u4096>("u4096", 530);
+    bench_fac<Z<Unsigned, 16384, Wrap>>("u16384", 1750);
+    bench_binomial<wrap::u32>("u32");
+    bench_binomial<wrap::u256>("u256");
+    bench_binomial<wrap::u1024>("u1024");
+    bench_binomial<wrap::u4096>("u4096");
+
+    std::printf("\nmul algorithms, Toom-3 at %u bits and up\n", BBI_TOOM3_THRESHOLD);
+    using bbi::detail::limb_bits;
+    bench_mul_kernels<1024/limb_bits>();
+    bench_mul_kernels<2048/limb_bits>();
+    bench_mul_kernels<4096/limb_bits>();
+    bench_mul_kernels<8192/limb_bits>();
+    bench_mul_kernels<16384/limb_bits>();
+    bench_mul_kernels<32768/limb_bits>();
+}
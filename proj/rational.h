@@ -605,6 +605,18 @@ operator*(rational<Nx> const& x, rational<Ny> const& y) noexcept
     return R{r2};
 }
 
+template <unsigned N>
+constexpr
+auto
+square(rational<N> const& x) noexcept
+{
+    using R = rational<N>;
+    using R2 = rational<2*R::size>;
+    using Z2 = typename R2::value_type;
+    R2 r2{square(Z2{x.num()}), square(Z2{x.den()})};
+    return R{r2};
+}
+
 template <unsigned Nx, detail::OperatesWithRational Y>
 constexpr
 auto
@@ -869,7 +881,17 @@ root(rational<N> f, Z<Unsigned, N2, P> du)
     if (recip)
         f.reciprocal();
     R r{1};
-    if (du < 100'000)
+    if (du < N - 2)
+    {
+        // f = p/q, and f^(1/d) ~= (p * 2^(d*s))^(1/d) / (q * 2^(d*s))^(1/d), with s as
+        // large as leaves both roots below 2^(N-1)
+        using V = typename R::value_type;
+        using W = Z<Unsigned, 2*N, Wrap>;
+        auto const d = unsigned(du);
+        auto const ds = int(d * ((N - 2) / d));
+        r = R{V{iroot(W{f.num()} << ds, d)}, V{iroot(W{f.den()} << ds, d)}};
+    }
+    else if (du < 100'000)
     {
         // Quadratic least squares curve fit of f^(1/d) in the range [0, 1]
         bbi::term::i64 di{du};
@@ -934,14 +956,12 @@ fac(rational<N> x)
             return R{V{1}, V{0}};
         return R{V{0}, V{0}};
     }
-    R r{V{1}};
-    if (x.num() > V{1})
-    {
-        R constexpr inf{V{1}, V{0}};
-        for (; x != R{1} && r != inf; --x)
-            r *= x;
-    }
-    return r;
+    // x! is exact if it fits in value_type, else inf
+    using U = Z<Unsigned, N, Saturate>;
+    auto const r = fac(U{x.num()});
+    if (r > U{std::numeric_limits<V>::max()})
+        return R{V{1}, V{0}};
+    return R{V{r}};
 }
 
 template <unsigned N>
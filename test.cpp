@@ -28,6 +28,8 @@
 #include <array>
 #include <cstdint>
 #include <iostream>
+#include <sstream>
+#include <utility>
 
 template <class T>
 void
@@ -3237,6 +3239,965 @@ test_mul()
     }
 }
 
+template <bbi::SignTag S, unsigned N, bbi::Policy P>
+constexpr
+void
+test_square()
+{
+    using Z = bbi::Z<S, N, P>;
+    using I2 = StandardInt_t<S, 2*N>;
+    auto constexpr rng = make_range<S, N, P>();
+    auto const M = I2{std::numeric_limits<Z>::max()};
+    for (auto rx = 0u; rx < rng.size(); ++rx)
+    {
+        auto i = rng[rx][0];
+        while (true)
+        {
+            Z zx{i};
+            I2 ix{i};
+            I2 i1 = ix * ix;
+            try
+            {
+                auto z1 = square(zx);
+                if (z1 != i1)
+                {
+                    if constexpr (P{} == bbi::Wrap{})
+                    {
+                        StandardInt_t<S, N> i0(i1);
+                        if (z1 != i0)
+                        {
+                            std::cout << "square(" << bbi::to_string<Z>() << "{" << zx
+                                      << "}) is " << z1 << " but should be " << i0+0 << '\n';
+                            return;
+                        }
+                    }
+                    else if constexpr (P{} == bbi::Saturate{})
+                    {
+                        if (i1 <= M || z1 != std::numeric_limits<Z>::max())
+                        {
+                            std::cout << "square(" << bbi::to_string<Z>() << "{" << zx
+                                      << "}) is " << z1 << " but should be "
+                                      << std::min(i1, M)+0 << '\n';
+                            return;
+                        }
+                    }
+                    else
+                    {
+                        std::cout << "square(" << bbi::to_string<Z>() << "{" << zx
+                                  << "}) is " << z1 << " but should be " << i1+0 << '\n';
+                        return;
+                    }
+                }
+            }
+            catch (std::exception const&)
+            {
+                if (P{} != bbi::Throw{} || i1 <= M)
+                {
+                    std::cout << "square(" << bbi::to_string<Z>() << "{" << zx
+                              << "}) threw an exception but should not have\n";
+                    return;
+                }
+            }
+            if (i == rng[rx][1])
+                break;
+            ++i;
+        }
+    }
+}
+
+// Products wider than any native type are checked against identities
+template <class Z>
+void
+test_mul_wide()
+{
+    auto constexpr N = Z::size;
+    unsigned const e[] = {1, 7, 63, 64, 65, 127, N/4, N/2-1, N/2, N/2+1, N-65, N-1};
+    for (auto a : e)
+    {
+        for (auto b : e)
+        {
+            // (2^a - 1) * (2^b - 1) == 2^(a+b) - 2^a - 2^b + 1 modulo 2^N
+            Z const x = (Z{1} << a) - Z{1};
+            Z const y = (Z{1} << b) - Z{1};
+            Z const z = (a+b < N ? Z{1} << (a+b) : Z{}) - (Z{1} << a) - (Z{1} << b) + Z{1};
+            if (x * y != z)
+            {
+                std::cout << bbi::to_string<Z>() << "{" << x << "} * "
+                          << bbi::to_string<Z>() << "{" << y
+                          << "} is " << x * y
+                          << " but should be " << z << '\n';
+                return;
+            }
+            // (x + y)^2 == x^2 + 2*x*y + y^2 modulo 2^N
+            Z const u = x ^ (y << 3);
+            Z const v = (x >> 2) + y;
+            Z const u2 = u;
+            if (square(u) != u*u2)
+            {
+                std::cout << "square(" << bbi::to_string<Z>() << "{" << u << "}) is "
+                          << square(u) << " but should be " << u*u2 << '\n';
+                return;
+            }
+            if ((u + v) * (u + v) != u*u + Z{2}*u*v + v*v)
+            {
+                std::cout << bbi::to_string<Z>() << "{" << u << "} + "
+                          << bbi::to_string<Z>() << "{" << v
+                          << "} squared is " << (u + v) * (u + v)
+                          << " but should be " << u*u + Z{2}*u*v + v*v << '\n';
+                return;
+            }
+        }
+    }
+}
+
+// detail::mul_n of n limbs against the basecase.  With n at and just above
+// BBI_TOOM3_THRESHOLD / limb_bits that is a Toom-3 product, whose pieces are Karatsuba.
+template <unsigned n>
+void
+test_mul_n()
+{
+    using bbi::detail::limb_t;
+    using L = std::array<limb_t, n>;
+    unsigned constexpr k = (n + 2) / 3;  // Toom-3 splits at k and 2k limbs
+    std::uint64_t s = 1;
+    auto const random = [&s]
+    {
+        L a;
+        for (auto& l : a)
+        {
+            s = s * 6364136223846793005u + 1442695040888963407u;
+            l = limb_t(s >> (64 - bbi::detail::limb_bits));
+        }
+        return a;
+    };
+    // a with limbs [m, n) zeroed
+    auto const low = [](L a, unsigned m)
+    {
+        for (unsigned i = m; i < n; ++i)
+            a[i] = 0;
+        return a;
+    };
+    // x and y at the same address are squared by mul_n
+    auto const check = [](L const& x, L const& y)
+    {
+        std::array<limb_t, 2*n> r;
+        std::array<limb_t, 2*n> e;
+        bbi::detail::mul_n<n>(r.data(), x.data(), y.data());
+        bbi::detail::mul_basecase(e.data(), x.data(), n, y.data(), n);
+        for (unsigned i = 0; i < 2*n; ++i)
+        {
+            if (r[i] != e[i])
+            {
+                std::cout << "mul_n<" << n << "> differs from the basecase at limb " << i
+                          << (&x == &y ? " when squaring\n" : "\n");
+                return false;
+            }
+        }
+        return true;
+    };
+    L ones;
+    ones.fill(~limb_t{});
+    auto const ones2 = ones;
+    auto const x = random();
+    auto const y = random();
+    // Zero high thirds make x2 and y2, or x1 and y1 too, zero
+    auto const x2 = low(x, 2*k);
+    auto const y2 = low(y, 2*k);
+    auto const x1 = low(x, k);
+    auto const ones1 = low(ones, 2*k);
+    (void)(check(ones, ones2) && check(ones, ones) && check(x, y) && check(x, x) &&
+           check(x2, y) && check(x, y2) && check(x2, y2) && check(x1, y2) &&
+           check(x2, x2) && check(ones1, ones) && check(ones1, ones1));
+}
+
+template <class Z>
+void
+test_div_wide()
+{
+    auto constexpr N = Z::size;
+    unsigned const e[] = {1, 7, 63, 64, 65, 127, N/4, N/2-1, N/2, N/2+1, N-65, N-2};
+    for (auto a : e)
+    {
+        for (auto b : e)
+        {
+            if (a + b > N - 2)
+                continue;
+            // ((2^a - 1) * y + r) / y == 2^a - 1 with remainder r
+            Z const q = (Z{1} << a) - Z{1};
+            Z const y = (Z{1} << b) - (Z{1} << (b/2));
+            Z const r = y - (Z{1} << (b/3));
+            Z const x = q * y + r;
+            if (x / y != q || x % y != r)
+            {
+                std::cout << bbi::to_string<Z>() << "{" << x << "} / "
+                          << bbi::to_string<Z>() << "{" << y
+                          << "} is " << x / y << " remainder " << x % y
+                          << " but should be " << q << " remainder " << r << '\n';
+                return;
+            }
+            if constexpr (std::numeric_limits<Z>::is_signed)
+            {
+                if (-x / y != -q || -x % y != -r)
+                {
+                    std::cout << bbi::to_string<Z>() << "{" << -x << "} / "
+                              << bbi::to_string<Z>() << "{" << y
+                              << "} is " << -x / y << " remainder " << -x % y
+                              << " but should be " << -q << " remainder " << -r << '\n';
+                    return;
+                }
+            }
+        }
+    }
+}
+
+// Pseudo-random test operands of the Wrap type W.  Each call returns the next w of
+// w = -(31 w + i), with i counting the calls, starting from max / 3.  Every limb of
+// w soon changes on each call, and the sign alternates for signed W.
+template <class W>
+class operands
+{
+    W w_ = std::numeric_limits<W>::max() / W{3};
+    int i_ = 0;
+
+public:
+    W operator()() {return w_ = -(w_ * W{31} + W{i_++});}
+};
+
+template <std::uint64_t C, class Z>
+bool
+test_div_by(Z const& x)
+{
+    // The expected results, computed in a type that holds C
+    using V = bbi::Z<typename Z::sign, std::max(Z::size, 128u), bbi::Wrap>;
+    Z const q{V{x} / V{C}};
+    Z const r{V{x} % V{C}};
+    if (div_by<C>(x) != q || rem_by<C>(x) != r)
+    {
+        std::cout << "div_by<" << C << ">(" << bbi::to_string<Z>() << "{" << x << "}) is "
+                  << div_by<C>(x) << " remainder " << rem_by<C>(x) << " but should be "
+                  << q << " remainder " << r << '\n';
+        return false;
+    }
+    return true;
+}
+
+template <class Z>
+void
+test_div_by()
+{
+    using W = bbi::Z<typename Z::sign, Z::size, bbi::Wrap>;
+    operands<W> next;
+    for (int i = 0; i < 40; ++i)
+    {
+        auto const w = next();
+        Z const x{w};
+        if (!test_div_by<1>(x) || !test_div_by<3>(x) || !test_div_by<10>(x) ||
+            !test_div_by<60>(x) || !test_div_by<64>(x) || !test_div_by<1000>(x) ||
+            !test_div_by<10'000'000'000'000'000'000u>(x) || !test_div_by<~0ull>(x) ||
+            !test_div_by<1ull << 63>(x))
+            return;
+    }
+    // min / 2^63 is -1 for i64
+    for (auto const& x : {std::numeric_limits<Z>::min(), std::numeric_limits<Z>::max()})
+    {
+        if (!test_div_by<1>(x) || !test_div_by<3>(x) || !test_div_by<64>(x) ||
+            !test_div_by<~0ull>(x) || !test_div_by<1ull << 63>(x))
+            return;
+    }
+}
+
+template <class Z>
+void
+test_divider()
+{
+    using W = bbi::Z<typename Z::sign, Z::size, bbi::Wrap>;
+    operands<W> next;
+    for (int i = 0; i < 40; ++i)
+    {
+        // Divisors of every length, each applied to several dividends
+        auto const w = next();
+        Z const d{(w >> unsigned(i * Z::size / 40)) | W{1}};
+        bbi::divider<Z> const dv{d};
+        W v = w;
+        for (int j = 0; j < 10; ++j)
+        {
+            v = -(v * W{37} + W{j});
+            Z const x{v};
+            auto const [q, r] = dv.divmod(x);
+            if (q != x / d || r != x % d || dv.quot(x) != q || dv.rem(x) != r)
+            {
+                std::cout << "divider<" << bbi::to_string<Z>() << ">{" << d << "}.divmod("
+                          << x << ") is " << bbi::div_t<Z>{q, r} << " but should be "
+                          << bbi::div_t<Z>{x / d, x % d} << '\n';
+                return;
+            }
+        }
+    }
+    if constexpr (std::is_same_v<typename Z::policy, bbi::Throw>)
+    {
+        bbi::divider<Z> const dv{Z{}};
+        try
+        {
+            (void)dv.quot(Z{1});
+            std::cout << "divider<" << bbi::to_string<Z>() << ">{0}.quot(1) did not throw\n";
+        }
+        catch (std::exception const&)
+        {
+        }
+    }
+}
+
+template <class Z>
+void
+test_to_string()
+{
+    using W = bbi::Z<typename Z::sign, Z::size, bbi::Wrap>;
+    // 10^k and 10^k - 1 straddle every chunk and split boundary
+    W p{1};
+    std::string zeros;
+    while (true)
+    {
+        std::string const nines(zeros.size(), '9');
+        if (to_string(Z{p}) != '1' + zeros || (!nines.empty() && to_string(Z{p - W{1}}) != nines))
+        {
+            std::cout << "to_string(" << bbi::to_string<Z>() << "{10^" << zeros.size()
+                      << "}) is " << to_string(Z{p}) << '\n';
+            return;
+        }
+        if (p > std::numeric_limits<W>::max() / W{10})
+            break;
+        p *= W{10};
+        zeros.push_back('0');
+    }
+    operands<W> next;
+    for (int i = 0; i < 40; ++i)
+    {
+        auto const w = next();
+        Z const x{w >> unsigned(i * Z::size / 40)};
+        std::ostringstream os;
+        os << x;
+        auto const str = to_string(x);
+        if (Z{str.c_str()} != x || os.str() != str || std::format("{}", x) != str)
+        {
+            std::cout << "to_string(" << bbi::to_string<Z>() << "{" << x << "}) is "
+                      << str << '\n';
+            return;
+        }
+    }
+}
+
+template <class Z>
+void
+test_from_string()
+{
+    using W = bbi::Z<typename Z::sign, Z::size, bbi::Wrap>;
+    auto const fail = [](std::string const& str, auto const& x)
+    {
+        std::cout << bbi::to_string<Z>() << "{\"" << str << "\"} is " << x << '\n';
+    };
+    // 10^k and 10^k - 1 straddle every chunk and split boundary
+    W p{1};
+    std::string zeros;
+    while (true)
+    {
+        auto const str = '1' + zeros;
+        auto const nines = std::string(zeros.size(), '9');
+        if (Z{str} != Z{p} || Z{"00" + str} != Z{p} || (!nines.empty() && Z{nines} != Z{p - W{1}}))
+            return fail(str, Z{str});
+        if constexpr (std::numeric_limits<Z>::is_signed)
+        {
+            if (Z{'-' + str} != Z{-p})
+                return fail('-' + str, Z{'-' + str});
+        }
+        if (p > std::numeric_limits<W>::max() / W{10})
+            break;
+        p *= W{10};
+        zeros.push_back('0');
+    }
+
+    // One digit too many overflows as the policy says
+    auto const big = to_string(std::numeric_limits<Z>::max()) + '7';
+    if constexpr (std::is_same_v<typename Z::policy, bbi::Throw>)
+    {
+        try
+        {
+            fail(big, Z{big});
+        }
+        catch (std::exception const&)
+        {
+        }
+    }
+    else if constexpr (std::is_same_v<typename Z::policy, bbi::Saturate>)
+    {
+        if (Z{big} != std::numeric_limits<Z>::max())
+            return fail(big, Z{big});
+    }
+    else
+    {
+        if (Z{big} != std::numeric_limits<Z>::max() * Z{10} + Z{7})
+            return fail(big, Z{big});
+    }
+
+    if constexpr (Z::size >= 128)
+    {
+        bool constexpr is_signed = std::numeric_limits<Z>::is_signed;
+        std::istringstream is{is_signed ? " -0012345678901234567890123x" : " +0012345678901234567890123x"};
+        Z x{};
+        is >> x;
+        W const y{"12345678901234567890123"};
+        if (x != Z{is_signed ? -y : y} || is.peek() != 'x')
+            return fail(is.str(), x);
+    }
+}
+
+template <class Z>
+void
+test_to_chars()
+{
+    using W = bbi::Z<typename Z::sign, Z::size, bbi::Wrap>;
+    auto const fail = [](char const* what, int base, Z const& x)
+    {
+        std::cout << what << '(' << bbi::to_string<Z>() << '{' << x << "}, " << base
+                  << ") failed\n";
+    };
+    std::array<char, Z::size + 2> buf;
+    auto const first = buf.data();
+    auto const last = first + buf.size();
+    operands<W> next;
+    for (int i = 0; i < 20; ++i)
+    {
+        auto const w = next();
+        Z const x{i < 2 ? (i == 0 ? std::numeric_limits<W>::min() : std::numeric_limits<W>::max())
+                        : w >> unsigned(i * Z::size / 20)};
+        for (int base = 2; base <= 36; ++base)
+        {
+            auto const [p, ec] = bbi::to_chars(first, last, x, base);
+            if (ec != std::errc{} || (base == 10 && std::string(first, p) != to_string(x)))
+                return fail("to_chars", base, x);
+            // One character short
+            auto const r = bbi::to_chars(first, p - 1, x, base);
+            if (r.ec != std::errc::value_too_large || r.ptr != p - 1)
+                return fail("to_chars", base, x);
+            Z y{};
+            auto const [q, ec2] = bbi::from_chars(first, p, y, base);
+            if (ec2 != std::errc{} || q != p || y != x)
+                return fail("from_chars", base, x);
+        }
+        // std::format's power of two bases agree with to_chars
+        auto const chars = [&](int base)
+        {
+            return std::string(first, bbi::to_chars(first, last, x, base).ptr);
+        };
+        if (std::format("{:b}", x) != chars(2) || std::format("{:o}", x) != chars(8) ||
+            std::format("{:x}", x) != chars(16))
+            return fail("std::format", 16, x);
+    }
+
+    // Errors leave the value alone, regardless of policy
+    Z x{5};
+    std::string str = to_string(std::numeric_limits<Z>::max()) + "0x";
+    auto r = bbi::from_chars(str.data(), str.data() + str.size(), x);
+    if (r.ec != std::errc::result_out_of_range || r.ptr != str.data() + str.size() - 1 ||
+        x != Z{5})
+        return fail("from_chars", 10, x);
+    str = std::string(Z::size/4 + 1, 'F');
+    r = bbi::from_chars(str.data(), str.data() + str.size(), x, 16);
+    if (r.ec != std::errc::result_out_of_range || x != Z{5})
+        return fail("from_chars", 16, x);
+    for (std::string const s : {"", "+1", "-", "z"})
+    {
+        r = bbi::from_chars(s.data(), s.data() + s.size(), x);
+        if (r.ec != std::errc::invalid_argument || r.ptr != s.data() || x != Z{5})
+            return fail("from_chars", 10, x);
+    }
+}
+
+template <class Z>
+void
+test_bytes()
+{
+    using U = bbi::Z<bbi::Unsigned, Z::size, bbi::Wrap>;
+    using W = bbi::Z<typename Z::sign, Z::size, bbi::Wrap>;
+    unsigned constexpr nb = Z::size / 8;
+    auto const fail = [](char const* what)
+    {
+        std::cout << what << " failed for " << bbi::to_string<Z>() << '\n';
+    };
+    std::array<std::byte, nb> in;
+    U u{};
+    U v{};
+    for (unsigned i = 0; i < nb; ++i)
+    {
+        in[i] = std::byte(i * 37 + 1);
+        u = u << 8 | U{(i * 37 + 1) & 0xFF};
+        v = v | U{(i * 37 + 1) & 0xFF} << (8 * i);
+    }
+    // in is u's big-endian representation, and v's little-endian one
+    auto const x = bbi::from_bytes<Z>(in, std::endian::big);
+    if (x != Z{W{u}} || bbi::from_bytes<Z>(in, std::endian::little) != Z{W{v}})
+        return fail("from_bytes");
+    std::array<std::byte, nb> out;
+    bbi::to_bytes(x, out, std::endian::big);
+    if (out != in)
+        return fail("to_bytes");
+    bbi::to_bytes(x, out, std::endian::little);
+    if (!std::equal(out.begin(), out.end(), in.rbegin()) ||
+        bbi::from_bytes<Z>(out, std::endian::little) != x)
+        return fail("to_bytes");
+    bbi::to_bytes(x, out);
+    if (bbi::from_bytes<Z>(out) != x)
+        return fail("to_bytes");
+    constexpr auto y = []
+    {
+        std::array<std::byte, nb> b{};
+        bbi::to_bytes(std::numeric_limits<Z>::min() + Z{5}, b);
+        return bbi::from_bytes<Z>(b);
+    }();
+    static_assert(y == std::numeric_limits<Z>::min() + Z{5});
+}
+
+template <class Z>
+void
+test_gcd()
+{
+    using U = bbi::Z<bbi::Unsigned, Z::size, bbi::Wrap>;
+    auto const check = [](Z const& x, Z const& y)
+    {
+        // Euclid's algorithm
+        auto a = U{x};
+        auto b = U{y};
+        while (b != 0)
+            a = std::exchange(b, a % b);
+        if (gcd(x, y) != Z{a})
+            std::cout << "gcd(" << x << ", " << y << ") is " << gcd(x, y) << '\n';
+        return gcd(x, y) == Z{a};
+    };
+    auto const m = std::numeric_limits<Z>::max();
+    if (!check(Z{0}, Z{0}) || !check(Z{0}, m) || !check(m, Z{0}) || !check(m, m) ||
+        !check(m, m - Z{1}))
+        return;
+    // Consecutive Fibonacci numbers take the most steps
+    Z a{0};
+    Z b{1};
+    while (b <= m - a)
+    {
+        a = std::exchange(b, a + b);
+        if (!check(a, b))
+            return;
+    }
+    operands<U> next;
+    for (int i = 0; i < 40; ++i)
+    {
+        auto const w = next();
+        Z const x{w >> unsigned(i * Z::size / 80)};
+        Z const g{(w >> unsigned(Z::size / 2 + i)) | U{1}};
+        if (!check(x, Z{w >> unsigned(i % 7)}) || !check(x / g * g, (x >> 3) / g * g))
+            return;
+    }
+}
+
+template <class Z>
+void
+test_ext_gcd()
+{
+    using U = bbi::Z<bbi::Unsigned, Z::size, bbi::Wrap>;
+    using W = bbi::Z<bbi::Signed, 2*Z::size, bbi::Wrap>;
+    auto const check = [](Z const& x, Z const& y)
+    {
+        auto const [g, s, t] = ext_gcd(x, y);
+        auto const as = U{s < 0 ? -s : s};
+        auto const at = U{t < 0 ? -t : t};
+        bool ok = g == gcd(x, y) && W{s} * W{x} + W{t} * W{y} == W{g};
+        if (g != 0)
+            ok = ok && (as <= 1 || as <= U{y} / U{g} / U{2}) &&
+                       (at <= 1 || at <= U{x} / U{g} / U{2});
+        auto const r = mod_inverse(x, y);
+        if (g == 1 && y != 0)
+            ok = ok && r < y && W{r} * W{x} % W{y} == (y == 1 ? W{0} : W{1});
+        else
+            ok = ok && r == 0;
+        if (!ok)
+            std::cout << "ext_gcd(" << x << ", " << y << ") is " << ext_gcd(x, y)
+                      << " and mod_inverse is " << r << '\n';
+        return ok;
+    };
+    auto const m = std::numeric_limits<Z>::max();
+    if (!check(Z{0}, Z{0}) || !check(Z{0}, m) || !check(m, Z{0}) || !check(m, m) ||
+        !check(m, m - Z{1}) || !check(Z{1}, Z{1}) || !check(Z{3}, Z{1}))
+        return;
+    Z a{0};
+    Z b{1};
+    while (b <= m - a)
+    {
+        a = std::exchange(b, a + b);
+        if (!check(a, b) || !check(b, a))
+            return;
+    }
+    // Operands of unequal lengths in both orders, and moduli 2^j, for which every odd
+    // x has an inverse and 2^j - 1 is the one of maximal length
+    operands<U> next;
+    for (int i = 0; i < 40; ++i)
+    {
+        auto const w = next();
+        Z const x{w};
+        Z const y{w >> unsigned(1 + i * (Z::size - 1) / 40)};
+        Z const p{U{1} << unsigned(i * (Z::size - 1) / 40)};
+        if (!check(x, y) || !check(y, x) || !check(x | Z{1}, p) || !check(p - Z{1}, p))
+            return;
+    }
+    // The signs of s and t follow those of x and y
+    using S = bbi::Z<bbi::Signed, Z::size, typename Z::policy>;
+    if (ext_gcd(S{-24}, Z{18}) != bbi::ext_gcd_t<Z>{Z{6}, S{-1}, S{-1}})
+        std::cout << "ext_gcd(-24, 18) is " << ext_gcd(S{-24}, Z{18}) << '\n';
+    if (ext_gcd(S{24}, S{-18}) != bbi::ext_gcd_t<Z>{Z{6}, S{1}, S{1}})
+        std::cout << "ext_gcd(24, -18) is " << ext_gcd(S{24}, S{-18}) << '\n';
+}
+
+template <class Z>
+void
+test_montgomery()
+{
+    using U = bbi::Z<bbi::Unsigned, Z::size, bbi::Wrap>;
+    using W = bbi::Z<bbi::Unsigned, 2*Z::size, bbi::Wrap>;
+    auto const mulmod = [](Z const& x, Z const& y, Z const& m)
+    {
+        return Z{W{x} * W{y} % W{m}};
+    };
+    auto const mx = std::numeric_limits<Z>::max();
+    operands<U> next;
+    for (int i = 0; i < 12; ++i)
+    {
+        auto const w = next();
+        Z const m = i == 0 ? Z{1} : i == 1 ? mx : Z{(w >> unsigned(i * Z::size / 16)) | U{1}};
+        bbi::montgomery<Z> const M{m};
+        if (M.modulus() != m)
+            std::cout << "montgomery{" << m << "}.modulus() is " << M.modulus() << '\n';
+        Z const x{~w};
+        Z const y{w >> 3};
+        auto const xm = M.to_mont(x);
+        auto const ym = M.to_mont(y);
+        auto const xr = x % m;
+        auto const yr = y % m;
+        if (M.from_mont(xm) != xr || M.from_mont(xm * ym) != mulmod(xr, yr, m) ||
+            M.from_mont(xm * xm) != mulmod(xr, xr, m) ||
+            M.from_mont(M.one() * ym) != yr ||
+            M.from_mont(xm + ym) != Z{(W{xr} + W{yr}) % W{m}} ||
+            M.from_mont(xm - ym) != Z{(W{xr} + W{m} - W{yr}) % W{m}} ||
+            M.from_mont(-xm) != Z{(W{m} - W{xr}) % W{m}} || xm != M.to_mont(xr))
+        {
+            std::cout << "montgomery{" << m << "} fails for " << x << " and " << y << '\n';
+            return;
+        }
+        auto p = M.one();
+        auto q = Z{1};
+        for (int j = 0; j < 20; ++j)
+        {
+            p *= xm;
+            q = mulmod(q, xr, m);
+        }
+        if (M.from_mont(p) != q)
+            std::cout << "montgomery{" << m << "}: " << x << "^20 is " << M.from_mont(p) << '\n';
+    }
+    if constexpr (std::is_same_v<typename Z::policy, bbi::Throw>)
+    {
+        try
+        {
+            bbi::montgomery<Z> const M{Z{10}};
+            std::cout << "montgomery{10} did not throw\n";
+        }
+        catch (std::domain_error const&)
+        {
+        }
+    }
+    if constexpr (Z::size <= 1024)
+    {
+        static_assert([]
+        {
+            bbi::montgomery<Z> const M{Z{251}};
+            return M.from_mont(M.to_mont(Z{200}) * M.to_mont(Z{100})) == Z{171};
+        }());
+    }
+}
+
+template <class Z>
+void
+test_powmod()
+{
+    using U = bbi::Z<bbi::Unsigned, Z::size, bbi::Wrap>;
+    using W = bbi::Z<bbi::Unsigned, 2*Z::size, bbi::Wrap>;
+    // Right to left square and multiply
+    auto constexpr reference = [](Z const& b, Z const& e, Z const& m)
+    {
+        W r{W{1} % W{m}};
+        W x{W{b} % W{m}};
+        for (U k{e}; k != 0; k >>= 1)
+        {
+            if (k & U{1})
+                r = r * x % W{m};
+            x = x * x % W{m};
+        }
+        return Z{r};
+    };
+    auto const check = [&](Z const& b, Z const& e, Z const& m)
+    {
+        auto const r = reference(b, e, m);
+        if (powmod(b, e, m) != r)
+            std::cout << "powmod(" << b << ", " << e << ", " << m << ") is "
+                      << powmod(b, e, m) << " not " << r << '\n';
+        if ((m & Z{1}) && powmod_sec(b, e, m) != r)
+            std::cout << "powmod_sec(" << b << ", " << e << ", " << m << ") is "
+                      << powmod_sec(b, e, m) << " not " << r << '\n';
+        return powmod(b, e, m) == r;
+    };
+    auto const mx = std::numeric_limits<Z>::max();
+    if (!check(Z{0}, Z{0}, Z{1}) || !check(Z{3}, Z{0}, Z{7}) || !check(mx, mx, mx) ||
+        !check(mx, mx, mx - Z{1}) || !check(Z{2}, mx, Z{1}) || !check(mx, Z{1}, Z{2}))
+        return;
+    operands<U> next;
+    for (int i = 0; i < 16; ++i)
+    {
+        auto const w = next();
+        Z const m{(w >> unsigned(i * Z::size / 32)) | U{2}};
+        Z const e{w >> unsigned(i % 3 * Z::size / 4)};
+        if (!check(Z{~w}, e, m) || !check(Z{~w}, e, m | Z{1}))
+            return;
+    }
+    if constexpr (Z::size <= 256)
+    {
+        using E = bbi::Z<bbi::Unsigned, 8, typename Z::policy>;
+        static_assert(powmod(Z{3}, E{200}, Z{251}) == reference(Z{3}, Z{200}, Z{251}));
+        static_assert(powmod_sec(Z{3}, E{200}, Z{251}) == reference(Z{3}, Z{200}, Z{251}));
+    }
+}
+
+template <class Z>
+void
+test_barrett()
+{
+    using U = bbi::Z<bbi::Unsigned, Z::size, bbi::Wrap>;
+    using W = bbi::Z<bbi::Unsigned, 2*Z::size, bbi::Wrap>;
+    auto const check = [](Z const& m, W const& x, Z const& a, Z const& b)
+    {
+        bbi::barrett<Z> const br{m};
+        if (br.modulus() != m || br.reduce(x) != Z{x % W{m}} ||
+            br.mul(a, b) != Z{W{a} * W{b} % W{m}})
+        {
+            std::cout << "barrett{" << m << "} fails for " << x << ", " << a << " and "
+                      << b << '\n';
+            return false;
+        }
+        return true;
+    };
+    auto const mx = std::numeric_limits<Z>::max();
+    auto const wx = std::numeric_limits<W>::max();
+    // m == 1, m == max, and each power of 2^8, including those of the limb base
+    if (!check(Z{1}, wx, mx, mx) || !check(mx, wx, mx, mx - Z{1}) ||
+        !check(mx, W{mx} * W{mx}, Z{1}, Z{0}))
+        return;
+    for (unsigned s = 0; s < Z::size; s += 8)
+    {
+        Z const m{U{1} << s};
+        if (!check(m, wx, mx, mx) || !check(m, W{m} * W{m} - W{1}, m - Z{1}, m - Z{1}) ||
+            !check(m + Z{1}, wx >> s, mx, m))
+            return;
+    }
+    operands<W> next;
+    for (int i = 0; i < 32; ++i)
+    {
+        auto const w = next();
+        Z const m{U{w >> unsigned(i * Z::size / 32)} | U{1}};
+        if (!check(m, w >> unsigned(i % 5 * Z::size / 4), Z{U{w >> 7}}, Z{U{~w}}) ||
+            !check(m, W{m} * W{m} - W{1}, m - Z{1}, m - Z{1}))
+            return;
+    }
+    static_assert([]
+    {
+        bbi::barrett<Z> const br{Z{100}};
+        return br.mul(Z{99}, Z{98}) == Z{2} && br.reduce(W{12345}) == Z{45};
+    }());
+}
+
+template <class Z>
+void
+test_fac()
+{
+    using P = typename Z::policy;
+    using U = bbi::Z<bbi::Unsigned, Z::size, bbi::Wrap>;
+    using W = bbi::Z<bbi::Unsigned, 2*Z::size, bbi::Wrap>;
+    // r is k! modulo 2^N, and w is k! until it overflows N bits
+    U r{1};
+    W w{1};
+    for (unsigned k = 0; k < Z::size + 72; ++k)
+    {
+        if (k > 1)
+        {
+            r *= U{k};
+            w *= W{k};
+        }
+        bool const fits = (w >> Z::size) == W{};
+        if (P{} == bbi::Wrap{} || fits)
+        {
+            if (fac(Z{k}) != Z{r})
+            {
+                std::cout << "fac(" << k << ") is " << fac(Z{k}) << '\n';
+                return;
+            }
+        }
+        else
+        {
+            if constexpr (P{} == bbi::Saturate{})
+            {
+                if (fac(Z{k}) != std::numeric_limits<Z>::max())
+                    std::cout << "fac(" << k << ") does not saturate\n";
+            }
+            else if constexpr (P{} == bbi::Throw{})
+            {
+                try
+                {
+                    auto const f = fac(Z{k});
+                    std::cout << "fac(" << k << ") does not throw: " << f << '\n';
+                }
+                catch (std::overflow_error const&)
+                {
+                }
+            }
+            return;
+        }
+    }
+    static_assert(fac(Z{0}) == Z{1} && fac(Z{5}) == Z{120});
+}
+
+template <class Z>
+void
+test_binomial()
+{
+    using P = typename Z::policy;
+    using U = bbi::Z<bbi::Unsigned, Z::size, bbi::Wrap>;
+    using W = bbi::Z<bbi::Unsigned, 4*Z::size, bbi::Wrap>;
+    // Rows of Pascal's triangle on either side of n == 2N
+    unsigned constexpr N = Z::size;
+    for (unsigned n : {0u, 1u, 2u, 7u, 8u, N - 1, N, N + 1, 2*N - 1, 2*N, 2*N + 1, 2*N + 8})
+    {
+        W c{1};
+        for (unsigned k = 0; k <= n; ++k)
+        {
+            if (k > 0)
+                c = c * W{n - k + 1} / W{k};
+            bool const fits = (c >> N) == W{};
+            if (fits || (n <= 2*N && P{} == bbi::Wrap{}))
+            {
+                if (binomial_coefficient(Z{n}, Z{k}) != Z{U{c}})
+                {
+                    std::cout << "binomial_coefficient(" << n << ", " << k << ") is "
+                              << binomial_coefficient(Z{n}, Z{k}) << '\n';
+                    return;
+                }
+            }
+            else if (n <= 2*N)
+            {
+                if constexpr (P{} == bbi::Saturate{})
+                {
+                    if (binomial_coefficient(Z{n}, Z{k}) != std::numeric_limits<Z>::max())
+                        std::cout << "binomial_coefficient(" << n << ", " << k
+                                  << ") does not saturate\n";
+                }
+                else if constexpr (P{} == bbi::Throw{})
+                {
+                    try
+                    {
+                        auto const b = binomial_coefficient(Z{n}, Z{k});
+                        std::cout << "binomial_coefficient(" << n << ", " << k
+                                  << ") does not throw: " << b << '\n';
+                    }
+                    catch (std::overflow_error const&)
+                    {
+                    }
+                }
+            }
+        }
+    }
+    static_assert(binomial_coefficient(Z{10}, Z{3}) == Z{120});
+}
+
+template <class Z>
+void
+test_tables()
+{
+    using W = bbi::Z<bbi::Unsigned, 2*Z::size, bbi::Wrap>;
+    W const m{std::numeric_limits<Z>::max()};
+    // x is 10^k, exactly
+    auto const& p = bbi::pow10_table<Z>;
+    W x{1};
+    for (unsigned k = 0; k < p.size(); ++k, x *= W{10})
+    {
+        if (W{p[k]} != x)
+        {
+            std::cout << "pow10_table[" << k << "] is " << p[k] << '\n';
+            return;
+        }
+    }
+    if (x <= m)
+        std::cout << "pow10_table has only " << p.size() << " entries\n";
+    // x is k!, exactly
+    auto const& f = bbi::fac_table<Z>;
+    x = W{1};
+    for (unsigned k = 0; k < f.size(); ++k)
+    {
+        if (k > 1)
+            x *= W{k};
+        if (W{f[k]} != x)
+        {
+            std::cout << "fac_table[" << k << "] is " << f[k] << '\n';
+            return;
+        }
+    }
+    if (x * W{f.size()} <= m)
+        std::cout << "fac_table has only " << f.size() << " entries\n";
+    static_assert(bbi::pow10_table<Z>[2] == Z{100} && bbi::fac_table<Z>[5] == Z{120});
+}
+
+template <class Z>
+void
+test_roots()
+{
+    using U = bbi::Z<bbi::Unsigned, Z::size, bbi::Wrap>;
+    using W = bbi::Z<bbi::Unsigned, 2*Z::size, bbi::Saturate>;
+    using E = bbi::Z<bbi::Unsigned, 32, bbi::Wrap>;
+    // x runs over small values, every power of 2 and its neighbors, and max
+    auto check = [](U const& u)
+    {
+        Z const x{u};
+        W const w{u};
+        auto const r = isqrt(x);
+        W const rw{U{r}};
+        if (!(rw * rw <= w && (rw + W{1}) * (rw + W{1}) > w))
+            std::cout << "isqrt(" << x << ") is " << r << '\n';
+        if (is_perfect_square(x) != (rw * rw == w))
+            std::cout << "is_perfect_square(" << x << ") is " << is_perfect_square(x) << '\n';
+        for (unsigned k : {1u, 2u, 3u, 7u, Z::size - 1, Z::size + 1})
+        {
+            W const q{U{iroot(x, k)}};
+            if (!(power(q, E{k}) <= w && power(q + W{1}, E{k}) > w))
+                std::cout << "iroot(" << x << ", " << k << ") is " << q << '\n';
+        }
+    };
+    for (unsigned i = 0; i < 300; ++i)
+        check(U{i});
+    for (unsigned i = 1; i < Z::size; ++i)
+    {
+        auto const p = U{1} << i;
+        check(p - U{1});
+        check(p);
+        check(p + U{1});
+        auto const s = U{1} << (i/2);
+        check(s * s - U{1});
+        check(s * s + U{1});
+    }
+    check(~U{});
+    static_assert(isqrt(Z{100}) == Z{10} && iroot(Z{125}, 3) == Z{5});
+    static_assert(is_perfect_square(Z{196}) && !is_perfect_square(Z{200}));
+}
+
 template <bbi::SignTag S, unsigned N, bbi::Policy P>
 void
 test_div()
@@ -3407,6 +4368,79 @@ test_div()
     }
 }
 
+template <bbi::SignTag S, unsigned N, bbi::Policy P>
+void
+test_divmod()
+{
+    using Z = bbi::Z<S, N, P>;
+    using I = StandardInt_t<S, N>;
+    using I2 = StandardInt_t<bbi::Signed, 2*N>;
+    auto constexpr rng = make_range<S, N, P>();
+    auto constexpr m = std::numeric_limits<I>::min();
+    for (auto rx = 0u; rx < rng.size(); ++rx)
+    {
+        auto i = rng[rx][0];
+        while (true)
+        {
+            for (auto ry = 0u; ry < rng.size(); ++ry)
+            {
+                auto j = rng[ry][0];
+                while (true)
+                {
+                    Z zx{i};
+                    Z zy{j};
+                    I ix{i};
+                    I iy{j};
+                    // The cases where x / y overflows are tested by test_div
+                    if (iy != 0 && !(std::is_signed_v<I> && ix == m && iy == I(-1)))
+                    {
+                        auto const z = divmod(zx, zy);
+                        if (z.quot != I(ix / iy) || z.rem != I(ix % iy) || zx % zy != z.rem)
+                        {
+                            std::cout << "divmod(" << bbi::to_string<Z>() << "{" << zx << "}, "
+                                      << bbi::to_string<Z>() << "{" << zy << "}) is " << z
+                                      << " but should be {" << I(ix / iy)+0 << ", "
+                                      << I(ix % iy)+0 << "}\n";
+                            return;
+                        }
+                        if constexpr (S{} == bbi::Signed{})
+                        {
+                            // r == x - q*y with |r| < |y|, and r takes the sign of y for floor_div,
+                            // the opposite sign for ceil_div, and is non-negative for euc_div.
+                            auto const ay = I2{iy} < 0 ? -I2{iy} : I2{iy};
+                            auto valid = [&](auto const& d, int sign)
+                            {
+                                auto const q = I2{I{d.quot}};
+                                auto const r = I2{I{d.rem}};
+                                if (r != I2{ix} - q*I2{iy} || r >= ay || -r >= ay)
+                                    return false;
+                                return r == 0 || (sign == 0 ? r > 0 : (r > 0) == (sign > 0));
+                            };
+                            int const sy = iy > 0 ? 1 : -1;
+                            if (!valid(floor_div(zx, zy), sy) || !valid(ceil_div(zx, zy), -sy)
+                                                              || !valid(euc_div(zx, zy), 0))
+                            {
+                                std::cout << bbi::to_string<Z>() << "{" << zx << "} / "
+                                          << bbi::to_string<Z>() << "{" << zy << "}: floor_div "
+                                          << floor_div(zx, zy) << " ceil_div "
+                                          << ceil_div(zx, zy) << " euc_div "
+                                          << euc_div(zx, zy) << '\n';
+                                return;
+                            }
+                        }
+                    }
+                    if (j == rng[ry][1])
+                        break;
+                    ++j;
+                }
+            }
+            if (i == rng[rx][1])
+                break;
+            ++i;
+        }
+    }
+}
+
 template <class U, class V>
 void
 implicit_equal_to_noexcept()
@@ -4728,6 +5762,160 @@ main()
     test_mul<bbi::Unsigned, 16, bbi::Throw>();
     test_mul<bbi::Unsigned, 32, bbi::Throw>();
 
+    test_square<bbi::Signed, 8, bbi::Wrap>();
+    test_square<bbi::Signed, 16, bbi::Wrap>();
+    test_square<bbi::Signed, 32, bbi::Wrap>();
+
+    test_square<bbi::Unsigned, 8, bbi::Wrap>();
+    test_square<bbi::Unsigned, 16, bbi::Wrap>();
+    test_square<bbi::Unsigned, 32, bbi::Wrap>();
+
+    test_square<bbi::Signed, 8, bbi::Saturate>();
+    test_square<bbi::Signed, 16, bbi::Saturate>();
+    test_square<bbi::Signed, 32, bbi::Saturate>();
+
+    test_square<bbi::Unsigned, 8, bbi::Saturate>();
+    test_square<bbi::Unsigned, 16, bbi::Saturate>();
+    test_square<bbi::Unsigned, 32, bbi::Saturate>();
+
+    test_square<bbi::Signed, 8, bbi::Throw>();
+    test_square<bbi::Signed, 16, bbi::Throw>();
+    test_square<bbi::Signed, 32, bbi::Throw>();
+
+    test_square<bbi::Unsigned, 8, bbi::Throw>();
+    test_square<bbi::Unsigned, 16, bbi::Throw>();
+    test_square<bbi::Unsigned, 32, bbi::Throw>();
+
+    test_mul_wide<bbi::wrap::u256>();
+    test_mul_wide<bbi::wrap::u2048>();
+    test_mul_wide<bbi::wrap::u4096>();
+    test_mul_wide<bbi::wrap::i2048>();
+    test_mul_wide<bbi::wrap::i4096>();
+    test_mul_wide<bbi::Z<bbi::Unsigned, 16384, bbi::Wrap>>();
+    test_mul_wide<bbi::Z<bbi::Signed, 16384, bbi::Wrap>>();
+    // Toom-3 for every n % 3
+    test_mul_n<BBI_TOOM3_THRESHOLD / bbi::detail::limb_bits>();
+    test_mul_n<BBI_TOOM3_THRESHOLD / bbi::detail::limb_bits + 1>();
+    test_mul_n<BBI_TOOM3_THRESHOLD / bbi::detail::limb_bits + 2>();
+
+    test_div_wide<bbi::wrap::u256>();
+    test_div_wide<bbi::wrap::u2048>();
+    test_div_wide<bbi::wrap::u4096>();
+    test_div_wide<bbi::wrap::i2048>();
+    test_div_wide<bbi::wrap::i4096>();
+
+    test_div_by<bbi::wrap::u8>();
+    test_div_by<bbi::wrap::i16>();
+    test_div_by<bbi::wrap::u32>();
+    test_div_by<bbi::wrap::i64>();
+    test_div_by<bbi::wrap::u128>();
+    test_div_by<bbi::sat::i128>();
+    test_div_by<bbi::wrap::u256>();
+    test_div_by<bbi::thrw::i256>();
+    test_div_by<bbi::wrap::u4096>();
+    test_div_by<bbi::wrap::i4096>();
+
+    test_divider<bbi::wrap::u8>();
+    test_divider<bbi::wrap::i16>();
+    test_divider<bbi::thrw::u32>();
+    test_divider<bbi::wrap::i64>();
+    test_divider<bbi::wrap::u128>();
+    test_divider<bbi::sat::i128>();
+    test_divider<bbi::wrap::u256>();
+    test_divider<bbi::thrw::i256>();
+    test_divider<bbi::wrap::u4096>();
+    test_divider<bbi::wrap::i4096>();
+
+    test_to_string<bbi::wrap::u8>();
+    test_to_string<bbi::wrap::i32>();
+    test_to_string<bbi::wrap::u64>();
+    test_to_string<bbi::wrap::i128>();
+    test_to_string<bbi::sat::u256>();
+    test_to_string<bbi::wrap::i512>();
+    test_to_string<bbi::wrap::u1024>();
+    test_to_string<bbi::thrw::i4096>();
+    test_to_string<bbi::Z<bbi::Unsigned, 16384, bbi::Wrap>>();
+
+    test_from_string<bbi::wrap::u8>();
+    test_from_string<bbi::sat::i32>();
+    test_from_string<bbi::thrw::u64>();
+    test_from_string<bbi::wrap::i128>();
+    test_from_string<bbi::sat::u256>();
+    test_from_string<bbi::thrw::i512>();
+    test_from_string<bbi::wrap::u1024>();
+    test_from_string<bbi::sat::i4096>();
+    test_from_string<bbi::Z<bbi::Unsigned, 16384, bbi::Wrap>>();
+
+    test_to_chars<bbi::wrap::u8>();
+    test_to_chars<bbi::wrap::i16>();
+    test_to_chars<bbi::sat::u64>();
+    test_to_chars<bbi::thrw::i128>();
+    test_to_chars<bbi::wrap::u256>();
+    test_to_chars<bbi::term::i512>();
+    test_to_chars<bbi::thrw::u2048>();
+
+    test_bytes<bbi::wrap::u8>();
+    test_bytes<bbi::thrw::i16>();
+    test_bytes<bbi::wrap::i64>();
+    test_bytes<bbi::wrap::u128>();
+    test_bytes<bbi::sat::i128>();
+    test_bytes<bbi::term::u256>();
+    test_bytes<bbi::thrw::i1024>();
+
+    test_gcd<bbi::wrap::u8>();
+    test_gcd<bbi::sat::u64>();
+    test_gcd<bbi::wrap::u128>();
+    test_gcd<bbi::thrw::u256>();
+    test_gcd<bbi::wrap::u512>();
+    test_gcd<bbi::term::u2048>();
+    test_ext_gcd<bbi::wrap::u8>();
+    test_ext_gcd<bbi::sat::u64>();
+    test_ext_gcd<bbi::thrw::u128>();
+    test_ext_gcd<bbi::wrap::u512>();
+    test_ext_gcd<bbi::term::u2048>();
+    // One limb at every BBI_LIMIT, then either side of BBI_KARATSUBA_THRESHOLD
+    test_montgomery<bbi::wrap::u8>();
+    test_montgomery<bbi::thrw::u64>();
+    test_montgomery<bbi::sat::u512>();
+    test_montgomery<bbi::thrw::u1024>();
+    test_montgomery<bbi::term::u2048>();
+    test_powmod<bbi::wrap::u8>();
+    test_powmod<bbi::sat::u128>();
+    test_powmod<bbi::thrw::u512>();
+    test_powmod<bbi::wrap::u1024>();
+    test_powmod<bbi::term::u2048>();
+    // There mul_n is Karatsuba, and powmod_sec must still multiply by the basecase
+    static_assert(2048 >= BBI_KARATSUBA_THRESHOLD);
+    // Full width moduli reduce with mul_n<n+1>, shorter ones with the basecase
+    test_barrett<bbi::wrap::u8>();
+    test_barrett<bbi::sat::u64>();
+    test_barrett<bbi::thrw::u256>();
+    test_barrett<bbi::wrap::u1024>();
+    test_barrett<bbi::term::u2048>();
+    // From fac_table up to BBI_LIMIT, by the prime swing above
+    test_fac<bbi::wrap::u8>();
+    test_fac<bbi::thrw::u64>();
+    test_fac<bbi::sat::u128>();
+    test_fac<bbi::wrap::u512>();
+    test_fac<bbi::thrw::u1024>();
+    // Rows n < 64 from pascal_64, and n <= 2N by prime factorization
+    test_binomial<bbi::wrap::u8>();
+    test_binomial<bbi::sat::u32>();
+    test_binomial<bbi::thrw::u64>();
+    test_binomial<bbi::wrap::u256>();
+    test_binomial<bbi::term::u1024>();
+    test_tables<bbi::wrap::u8>();
+    test_tables<bbi::sat::i32>();
+    test_tables<bbi::thrw::u64>();
+    test_tables<bbi::wrap::i128>();
+    test_tables<bbi::term::u1024>();
+    // isqrt of at most 64 bits directly, and wider by Newton's method
+    test_roots<bbi::wrap::u16>();
+    test_roots<bbi::sat::u64>();
+    test_roots<bbi::wrap::u128>();
+    test_roots<bbi::thrw::u512>();
+    test_roots<bbi::term::u1024>();
+
 
     test_div<bbi::Unsigned, 8, bbi::Wrap>();
     test_div<bbi::Unsigned, 16, bbi::Wrap>();
@@ -4759,6 +5947,22 @@ main()
     test_div<bbi::Signed, 32, bbi::Throw>();
     test_div<bbi::Signed, 64, bbi::Throw>();
 
+    test_divmod<bbi::Unsigned, 8, bbi::Wrap>();
+    test_divmod<bbi::Unsigned, 16, bbi::Wrap>();
+    test_divmod<bbi::Unsigned, 32, bbi::Wrap>();
+
+    test_divmod<bbi::Signed, 8, bbi::Wrap>();
+    test_divmod<bbi::Signed, 16, bbi::Wrap>();
+    test_divmod<bbi::Signed, 32, bbi::Wrap>();
+
+    test_divmod<bbi::Signed, 8, bbi::Saturate>();
+    test_divmod<bbi::Signed, 16, bbi::Saturate>();
+    test_divmod<bbi::Signed, 32, bbi::Saturate>();
+
+    test_divmod<bbi::Signed, 8, bbi::Throw>();
+    test_divmod<bbi::Signed, 16, bbi::Throw>();
+    test_divmod<bbi::Signed, 32, bbi::Throw>();
+
     // test that noexcept for bbi::thrw construction is
     // consistent with explicit (implicit conversions can't throw)
     {